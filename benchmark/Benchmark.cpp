@@ -0,0 +1,81 @@
+#include "pch.h"
+#include "Benchmark.h"
+
+#include <chrono>
+#include <cmath>
+
+using namespace Ecosim;
+using namespace std::chrono;
+using namespace std;
+using namespace glm;
+
+BenchmarkResult Benchmark::measure(const string& name, const string& param,
+	uint64_t opsPerRep, uint32_t numReps, const Body& setup, const Body& body)
+{
+	assert(opsPerRep > 0 && numReps > 0);
+
+	// warm caches and any lazily built state
+	if(setup)
+	{
+		setup();
+	}
+	body();
+
+	vector<double> samples;
+	samples.reserve(numReps);
+	for(uint32_t i = 0; i < numReps; ++i)
+	{
+		if(setup)
+		{
+			setup();
+		}
+
+		steady_clock::time_point start = steady_clock::now();
+		body();
+		steady_clock::time_point end = steady_clock::now();
+
+		samples.push_back(duration_cast<duration<double, nano>>(end - start).count() / opsPerRep);
+	}
+
+	double total = 0.0;
+	double minNs = samples[0];
+	for(double sample : samples)
+	{
+		total += sample;
+		minNs = std::min(minNs, sample);
+	}
+	double meanNs = total / numReps;
+
+	double squaredError = 0.0;
+	for(double sample : samples)
+	{
+		squaredError += (sample - meanNs) * (sample - meanNs);
+	}
+	double stddevNs = numReps > 1 ? std::sqrt(squaredError / (numReps - 1)) : 0.0;
+
+	return BenchmarkResult{ name, param, opsPerRep, numReps, meanNs, stddevNs, minNs };
+}
+
+//-------------------------------------------------------------
+
+void Benchmark::writeHeader(ostream& stream)
+{
+	stream << "name,param,reps,ops_per_rep,ns_per_op,ns_per_op_stddev,ns_per_op_min,ops_per_sec" << endl;
+}
+
+//-------------------------------------------------------------
+
+void Benchmark::writeResult(ostream& stream, const BenchmarkResult& result)
+{
+	double opsPerSecond = result.meanNs > 0.0 ? 1.0e9 / result.meanNs : 0.0;
+
+	stream <<
+		result.name << "," <<
+		result.param << "," <<
+		result.numReps << "," <<
+		result.opsPerRep << "," <<
+		result.meanNs << "," <<
+		result.stddevNs << "," <<
+		result.minNs << "," <<
+		opsPerSecond << endl;
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+namespace Ecosim
+{
+	/**	Timing of one benchmark case.
+	 */
+	struct BenchmarkResult
+	{
+		std::string name;
+		std::string param;
+
+		std::uint64_t opsPerRep;
+		std::uint32_t numReps;
+
+		double meanNs;		// per op
+		double stddevNs;	// per op, across reps
+		double minNs;		// per op
+	};
+
+	//=============================================================
+
+	/**	Static utility class for timing small pieces of
+	 *	code and reporting the results as CSV.
+	 *
+	 *	A case runs its body once to warm up, then times
+	 *	each of several repetitions. Every repetition does
+	 *	a known number of operations, so each one yields a
+	 *	time per operation; the spread across repetitions
+	 *	is the variance reported.
+	 */
+	class Benchmark final
+	{
+	public:
+
+		typedef std::function<void()> Body;
+
+		/**	@brief Times a benchmark case.
+		 *
+		 *	@param name The name of the case.
+		 *	@param param A description of the case's size.
+		 *	@param opsPerRep The operations one call of the
+		 *					 body performs.
+		 *	@param numReps The number of timed repetitions.
+		 *	@param setup Runs untimed before each repetition.
+		 *				 May be empty.
+		 *	@param body Runs timed once per repetition.
+		 *
+		 *	@return Returns the timing.
+		 */
+		static BenchmarkResult measure(const std::string& name, const std::string& param,
+			std::uint64_t opsPerRep, std::uint32_t numReps, const Body& setup, const Body& body);
+
+		/**	@brief Writes the CSV column names.
+		 *
+		 *	@param stream The stream to which we write.
+		 */
+		static void writeHeader(std::ostream& stream);
+
+		/**	@brief Writes one timing as a CSV row.
+		 *
+		 *	@param stream The stream to which we write.
+		 *	@param result The timing.
+		 */
+		static void writeResult(std::ostream& stream, const BenchmarkResult& result);
+	};
+}
@@ -0,0 +1,246 @@
+#include "pch.h"
+#include "ScalingBenchmark.h"
+
+#include "ThreadPool.h"
+
+#include <chrono>
+#include <cstring>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+using namespace Ecosim;
+using namespace std::chrono;
+using namespace std;
+using namespace glm;
+
+// same world as the windowed sim
+const vec2 WORLD_SIZE(1500.0f, 1000.0f);
+
+const char* const CSV_KEY_COLUMNS = "agents,resources,threads";
+
+ScalingResult ScalingBenchmark::run(const ScalingCase& size, uint32_t numTicks, float timeStep, uint64_t seed)
+{
+	assert(size.numThreads > 0 && numTicks > 0);
+
+	WorldConfig config;
+	config.bounds = WORLD_SIZE;
+	config.numResources = size.numResources;
+	config.savesGenomes = false;
+	config.logsFitness = false;
+	config.profilesPhases = true;
+
+	// random genomes, two prey to each predator as in the genome files
+	uint32_t numPredators = size.numAgents / 3;
+	config.species.resize(2);
+	config.species[0].isPrey = true;
+	config.species[0].count = size.numAgents - numPredators;
+	config.species[1].isPrey = false;
+	config.species[1].count = numPredators;
+
+	// build every world first, so only stepping is timed
+	vector<unique_ptr<World>> worlds;
+	for(uint32_t i = 0; i < size.numThreads; ++i)
+	{
+		config.seed = seed + i;
+		worlds.emplace_back(new World());
+		worlds.back()->init(config);
+	}
+
+	resetPeakRss();
+
+	ThreadPool threadPool(size.numThreads);
+	steady_clock::time_point start = steady_clock::now();
+	for(auto& world : worlds)
+	{
+		World* stepped = world.get();
+		threadPool.enqueue([stepped, numTicks, timeStep]()
+		{
+			SimClock clock;
+			for(uint32_t tick = 0; tick < numTicks; ++tick)
+			{
+				clock.step(timeStep);
+				stepped->update(clock);
+			}
+		});
+	}
+	threadPool.waitIdle();
+	double wallSeconds = duration<double>(steady_clock::now() - start).count();
+
+	ScalingResult result;
+	result.size = size;
+	result.numTicks = numTicks;
+	result.wallSeconds = wallSeconds;
+	result.ticksPerSecond = static_cast<double>(numTicks) * size.numThreads / wallSeconds;
+	result.agentUpdatesPerSecond = result.ticksPerSecond * size.numAgents;
+	result.peakRssKB = getPeakRssKB();
+
+	// phase times are averaged over every world tick
+	double numWorldTicks = static_cast<double>(numTicks) * size.numThreads;
+	for(uint32_t phase = 0; phase < PhaseTimes::COUNT; ++phase)
+	{
+		double totalSeconds = 0.0;
+		for(const auto& world : worlds)
+		{
+			totalSeconds += world->getPhaseTimes().seconds[phase];
+		}
+		result.phaseMs[phase] = totalSeconds * 1000.0 / numWorldTicks;
+	}
+
+	for(auto& world : worlds)
+	{
+		world->shutdown();
+	}
+
+	return result;
+}
+
+//-------------------------------------------------------------
+
+void ScalingBenchmark::writeHeader(ostream& stream)
+{
+	stream << CSV_KEY_COLUMNS << ",ticks,wall_seconds,ticks_per_sec,agent_updates_per_sec,peak_rss_kb";
+	for(uint32_t phase = 0; phase < PhaseTimes::COUNT; ++phase)
+	{
+		stream << ',' << PhaseTimes::getName(static_cast<PhaseTimes::Phase>(phase)) << "_ms";
+	}
+	stream << endl;
+}
+
+//-------------------------------------------------------------
+
+void ScalingBenchmark::writeResult(ostream& stream, const ScalingResult& result)
+{
+	stream << result.size.numAgents << ','
+		<< result.size.numResources << ','
+		<< result.size.numThreads << ','
+		<< result.numTicks << ','
+		<< result.wallSeconds << ','
+		<< result.ticksPerSecond << ','
+		<< result.agentUpdatesPerSecond << ','
+		<< result.peakRssKB;
+
+	for(double phaseMs : result.phaseMs)
+	{
+		stream << ',' << phaseMs;
+	}
+	stream << endl;
+}
+
+//-------------------------------------------------------------
+
+bool ScalingBenchmark::readResults(istream& stream, vector<ScalingResult>& outResults)
+{
+	outResults.clear();
+
+	string line;
+	if(!getline(stream, line) || line.compare(0, strlen(CSV_KEY_COLUMNS), CSV_KEY_COLUMNS) != 0)
+	{
+		return false;
+	}
+
+	while(getline(stream, line))
+	{
+		// commas become spaces, so the row reads like any other stream
+		std::replace(line.begin(), line.end(), ',', ' ');
+		istringstream row(line);
+
+		ScalingResult result;
+		row >> result.size.numAgents >> result.size.numResources >> result.size.numThreads
+			>> result.numTicks >> result.wallSeconds >> result.ticksPerSecond
+			>> result.agentUpdatesPerSecond >> result.peakRssKB;
+		for(double& phaseMs : result.phaseMs)
+		{
+			row >> phaseMs;
+		}
+
+		if(row)
+		{
+			outResults.push_back(result);
+		}
+	}
+
+	return true;
+}
+
+//-------------------------------------------------------------
+
+uint32_t ScalingBenchmark::compare(const vector<ScalingResult>& results, const vector<ScalingResult>& baseline,
+	float threshold, ostream& stream)
+{
+	uint32_t numRegressions = 0;
+	for(const ScalingResult& result : results)
+	{
+		auto baselineIter = std::find_if(baseline.begin(), baseline.end(), [&result](const ScalingResult& other)
+		{
+			return other.size.numAgents == result.size.numAgents &&
+				other.size.numResources == result.size.numResources &&
+				other.size.numThreads == result.size.numThreads;
+		});
+
+		if(baselineIter == baseline.end())
+		{
+			continue;
+		}
+
+		double change = result.ticksPerSecond / baselineIter->ticksPerSecond - 1.0;
+		bool isRegression = change < -threshold;
+		if(isRegression)
+		{
+			++numRegressions;
+		}
+
+		stream << (isRegression ? "REGRESSION " : "ok         ")
+			<< "agents=" << result.size.numAgents
+			<< " resources=" << result.size.numResources
+			<< " threads=" << result.size.numThreads
+			<< " ticks/s " << baselineIter->ticksPerSecond << " -> " << result.ticksPerSecond
+			<< " (" << (change >= 0.0 ? "+" : "") << change * 100.0 << "%)" << endl;
+	}
+
+	return numRegressions;
+}
+
+//-------------------------------------------------------------
+
+void ScalingBenchmark::resetPeakRss()
+{
+#ifdef __linux__
+	// writing 5 to clear_refs resets the high water mark
+	ofstream clearRefs("/proc/self/clear_refs");
+	clearRefs << "5";
+#endif
+}
+
+//-------------------------------------------------------------
+
+uint64_t ScalingBenchmark::getPeakRssKB()
+{
+#ifdef __linux__
+	// VmHWM follows clear_refs resets, which getrusage does not
+	ifstream status("/proc/self/status");
+	string line;
+	while(getline(status, line))
+	{
+		if(line.compare(0, 6, "VmHWM:") == 0)
+		{
+			return strtoull(line.c_str() + 6, nullptr, 10);
+		}
+	}
+#endif
+
+#if defined(__unix__) || defined(__APPLE__)
+	rusage usage;
+	if(getrusage(RUSAGE_SELF, &usage) == 0)
+	{
+#ifdef __APPLE__
+		return static_cast<uint64_t>(usage.ru_maxrss) / 1024;
+#else
+		return static_cast<uint64_t>(usage.ru_maxrss);
+#endif
+	}
+#endif
+
+	return 0;
+}
@@ -0,0 +1,122 @@
+#pragma once
+
+#include "World.h"
+
+namespace Ecosim
+{
+	/**	Size of one scaling run.
+	 */
+	struct ScalingCase
+	{
+		std::uint32_t numAgents;
+		std::uint32_t numResources;	// of each type
+		std::uint32_t numThreads;	// one World per thread
+	};
+
+	//=============================================================
+
+	/**	Timing of one scaling run.
+	 */
+	struct ScalingResult
+	{
+		ScalingCase size;
+		std::uint32_t numTicks;
+
+		double wallSeconds;
+		double ticksPerSecond;			// summed over every World
+		double agentUpdatesPerSecond;	// summed over every World
+		std::uint64_t peakRssKB;
+
+		double phaseMs[PhaseTimes::COUNT];	// per World tick
+	};
+
+	//=============================================================
+
+	/**	Static utility class for timing whole Worlds
+	 *	end to end as they grow.
+	 *
+	 *	A World steps its objects one after another, so
+	 *	thread counts are measured by running that many
+	 *	same-sized Worlds side by side, each on its own
+	 *	thread, the way islands and sweeps run them. Rates
+	 *	are summed over every World in the run.
+	 *
+	 *	Results are written as CSV and can be read back as
+	 *	a baseline, so later runs can be checked for
+	 *	regressions.
+	 */
+	class ScalingBenchmark final
+	{
+	public:
+
+		/**	@brief Builds Worlds of one size and steps them
+		 *		   together for a fixed number of ticks.
+		 *
+		 *	@param size The number of Agents, Resources,
+		 *				and threads.
+		 *	@param numTicks The ticks each World steps.
+		 *	@param timeStep The simulated seconds per tick.
+		 *	@param seed The seed of the first World. The
+		 *				others count up from it.
+		 *
+		 *	@return Returns the timing.
+		 */
+		static ScalingResult run(const ScalingCase& size, std::uint32_t numTicks, float timeStep, std::uint64_t seed);
+
+		/**	@brief Writes the CSV column names.
+		 *
+		 *	@param stream The stream to which we write.
+		 */
+		static void writeHeader(std::ostream& stream);
+
+		/**	@brief Writes one timing as a CSV row.
+		 *
+		 *	@param stream The stream to which we write.
+		 *	@param result The timing.
+		 */
+		static void writeResult(std::ostream& stream, const ScalingResult& result);
+
+		/**	@brief Reads timings written by writeHeader and
+		 *		   writeResult.
+		 *
+		 *	@param stream The stream holding the CSV.
+		 *	@param outResults Receives the timings. Cleared first.
+		 *
+		 *	@return Returns false if the stream is not a
+		 *			scaling CSV.
+		 */
+		static bool readResults(std::istream& stream, std::vector<ScalingResult>& outResults);
+
+		/**	@brief Compares timings against a baseline, run
+		 *		   by run, and reports each run whose tick rate
+		 *		   fell by more than the threshold.
+		 *
+		 *	@param results The new timings.
+		 *	@param baseline The old timings. Runs missing from
+		 *					either side are skipped.
+		 *	@param threshold The fraction of the baseline rate
+		 *					 a run may lose before it counts
+		 *					 as a regression.
+		 *	@param stream The stream the report is written to.
+		 *
+		 *	@return Returns the number of regressions.
+		 */
+		static std::uint32_t compare(const std::vector<ScalingResult>& results, const std::vector<ScalingResult>& baseline,
+			float threshold, std::ostream& stream);
+
+	private:
+
+		/**	@brief Forgets the process's resident set high
+		 *		   water mark, where the OS allows it.
+		 */
+		static void resetPeakRss();
+
+		/**	@brief Gets the process's resident set high
+		 *		   water mark.
+		 *
+		 *	@return Returns the peak in kilobytes, or 0 if
+		 *			the OS doesn't say.
+		 */
+		static std::uint64_t getPeakRssKB();
+	};
+}
@@ -0,0 +1,159 @@
+#include "pch.h"
+#include "ScalingBenchmark.h"
+
+using namespace Ecosim;
+using namespace std;
+using namespace glm;
+
+namespace
+{
+	/**	Parses a comma separated list of counts.
+	 */
+	bool parseCounts(const string& text, vector<uint32_t>& outCounts)
+	{
+		outCounts.clear();
+
+		istringstream stream(text);
+		string item;
+		while(getline(stream, item, ','))
+		{
+			int32_t count = atoi(item.c_str());
+			if(count <= 0)
+			{
+				return false;
+			}
+			outCounts.push_back(static_cast<uint32_t>(count));
+		}
+
+		return !outCounts.empty();
+	}
+}
+
+//-------------------------------------------------------------
+
+int32_t main(int32_t argc, char* argv[])
+{
+	vector<uint32_t> agentCounts = { 100, 1000, 10000 };
+	vector<uint32_t> resourceCounts = { 25 };
+	vector<uint32_t> threadCounts = { 1 };
+	uint32_t numTicks = 100;
+	float timeStep = 1.0f / 60.0f;
+	uint64_t seed = 1;
+	string outputPath;
+	string baselinePath;
+	float threshold = 0.1f;
+
+	uint32_t numHardwareThreads = std::thread::hardware_concurrency();
+	if(numHardwareThreads > 1)
+	{
+		threadCounts.push_back(numHardwareThreads);
+	}
+
+	for(int32_t i = 1; i + 1 < argc; i += 2)
+	{
+		string option = argv[i];
+		string value = argv[i + 1];
+
+		bool isValid = true;
+		if(option == "--agents")
+		{
+			isValid = parseCounts(value, agentCounts);
+		}
+		else if(option == "--resources")
+		{
+			isValid = parseCounts(value, resourceCounts);
+		}
+		else if(option == "--threads")
+		{
+			isValid = parseCounts(value, threadCounts);
+		}
+		else if(option == "--ticks")
+		{
+			numTicks = static_cast<uint32_t>(std::max(atoi(value.c_str()), 1));
+		}
+		else if(option == "--timestep")
+		{
+			timeStep = static_cast<float>(atof(value.c_str()));
+			isValid = timeStep > 0.0f;
+		}
+		else if(option == "--seed")
+		{
+			seed = strtoull(value.c_str(), nullptr, 10);
+		}
+		else if(option == "--output")
+		{
+			outputPath = value;
+		}
+		else if(option == "--baseline")
+		{
+			baselinePath = value;
+		}
+		else if(option == "--threshold")
+		{
+			threshold = static_cast<float>(atof(value.c_str()));
+		}
+		else
+		{
+			isValid = false;
+		}
+
+		if(!isValid)
+		{
+			cerr << "Scaling -- bad option " << option << " " << value << endl;
+			return -1;
+		}
+	}
+
+	// read the baseline up front, so a bad path fails before the long part
+	vector<ScalingResult> baseline;
+	if(!baselinePath.empty())
+	{
+		ifstream baselineFile(baselinePath);
+		if(!ScalingBenchmark::readResults(baselineFile, baseline))
+		{
+			cerr << "Scaling -- could not read baseline " << baselinePath << endl;
+			return -1;
+		}
+	}
+
+	ofstream outputFile;
+	if(!outputPath.empty())
+	{
+		outputFile.open(outputPath);
+		if(!outputFile.is_open())
+		{
+			cerr << "Scaling -- could not open " << outputPath << endl;
+			return -1;
+		}
+	}
+	ostream& output = outputPath.empty() ? cout : outputFile;
+
+	// smallest runs first, so a size that is too big to finish still leaves the rest
+	vector<ScalingResult> results;
+	ScalingBenchmark::writeHeader(output);
+	for(uint32_t numAgents : agentCounts)
+	{
+		for(uint32_t numResources : resourceCounts)
+		{
+			for(uint32_t numThreads : threadCounts)
+			{
+				results.push_back(ScalingBenchmark::run(ScalingCase{ numAgents, numResources, numThreads }, numTicks, timeStep, seed));
+				ScalingBenchmark::writeResult(output, results.back());
+			}
+		}
+	}
+
+	if(baseline.empty())
+	{
+		return 0;
+	}
+
+	uint32_t numRegressions = ScalingBenchmark::compare(results, baseline, threshold, cerr);
+	if(numRegressions > 0)
+	{
+		cerr << "Scaling -- " << numRegressions << " run(s) regressed more than " << threshold * 100.0f << "%" << endl;
+		return 1;
+	}
+
+	return 0;
+}
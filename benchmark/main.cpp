@@ -0,0 +1,353 @@
+#include "pch.h"
+#include "Benchmark.h"
+
+#include "Agent.h"
+#include "Event.h"
+#include "EventArgs.h"
+#include "World.h"
+
+using namespace std::experimental::filesystem;
+using namespace Ecosim;
+using namespace std;
+using namespace glm;
+
+// world the kernels run in, the same size as the windowed sim
+const vec2 WORLD_SIZE(1500.0f, 1000.0f);
+
+// agents whose perception is timed, per rep
+const uint32_t NUM_OBSERVERS = 64;
+const uint32_t OBJECT_COUNTS[] = { 100, 1000, 10000 };
+
+// opening thresholds timed for far-field perception, with the cell size the World uses
+const float FAR_FIELD_THETAS[] = { 0.25f, 0.5f };
+const float FAR_FIELD_CELL_SIZE = 64.0f;
+
+// perception kernels timed at each supported cone count
+const uint32_t CONE_COUNTS[] = { 4, 8, 16, 32 };
+const uint32_t CONE_OBJECT_COUNT = 1000;
+
+const uint32_t NETWORK_EVALS_PER_GENOME = 1000;
+const uint32_t GENOME_OPS_PER_REP = 1000;
+const uint32_t EVENTS_PER_REP = 10000;
+
+namespace
+{
+	/**	Agent that exposes its per-type kernels.
+	 */
+	class BenchAgent final : public Agent
+	{
+	public:
+
+		BenchAgent(const vec3& pos, const vec3& facing, const Species& species = Species::get(Species::PREY)) :
+			Agent(species, pos, facing)
+		{
+			setRadius(10.0f);
+			activateCollision();
+		}
+
+		using Agent::updatePerceptionBlock;
+	};
+
+	//=============================================================
+
+	/**	Counts the events it is sent.
+	 */
+	class CountingSubscriber final : public ISubscriber
+	{
+	public:
+
+		virtual void notify(const IPublisher& e) override
+		{
+			UNREFERENCED_PARAMETER(e);
+			++count;
+		}
+
+		uint64_t count = 0;
+	};
+
+	//=============================================================
+
+	/**	Reads every Genome file the sim would load, keeping
+	 *	their text too. Must run with a World bound.
+	 */
+	void loadGenomes(vector<unique_ptr<Genome>>& outGenomes, vector<string>& outTexts)
+	{
+		vector<path> genomePaths;
+		for(auto& file : directory_iterator(DIR_GENOMES))
+		{
+			genomePaths.push_back(file.path());
+		}
+		std::sort(genomePaths.begin(), genomePaths.end());
+
+		for(const path& genomePath : genomePaths)
+		{
+			ifstream genomeFile(genomePath.c_str());
+			stringstream text;
+			text << genomeFile.rdbuf();
+			outTexts.push_back(text.str());
+
+			uint32_t id; bool usesNEAT, isPrey;
+			text >> id >> usesNEAT >> isPrey;
+
+			outGenomes.emplace_back(new Genome(id, Species::forGenome(isPrey).numInputs, usesNEAT, isPrey));
+			outGenomes.back()->readFromStream(text);
+		}
+	}
+
+	//=============================================================
+
+	/**	Scatters observers and targets over the world.
+	 *	Must run with a World bound.
+	 */
+	void scatterAgents(uint32_t numTargets, vector<unique_ptr<BenchAgent>>& outObservers, vector<unique_ptr<BenchAgent>>& outTargets,
+		const Species& observerSpecies = Species::get(Species::PREY))
+	{
+		for(uint32_t i = 0; i < numTargets; ++i)
+		{
+			vec3 pos(Random::randomRange(0.0f, WORLD_SIZE.x), Random::randomRange(0.0f, WORLD_SIZE.y), 0.0f);
+			outTargets.emplace_back(new BenchAgent(pos, vec3(0.0f, 1.0f, 0.0f)));
+		}
+
+		for(uint32_t i = 0; i < NUM_OBSERVERS; ++i)
+		{
+			vec3 pos(Random::randomRange(0.0f, WORLD_SIZE.x), Random::randomRange(0.0f, WORLD_SIZE.y), 0.0f);
+			float angle = Random::randomRange(0.0f, TWOPI);
+			outObservers.emplace_back(new BenchAgent(pos, vec3(std::cos(angle), std::sin(angle), 0.0f), observerSpecies));
+		}
+	}
+}
+
+//-------------------------------------------------------------
+
+int32_t main(int32_t argc, char* argv[])
+{
+	// --reps <count> --filter <substring>
+	uint32_t numReps = 20;
+	string filter;
+	for(int32_t i = 1; i + 1 < argc; i += 2)
+	{
+		string option = argv[i];
+		if(option == "--reps")
+		{
+			numReps = static_cast<uint32_t>(std::max(atoi(argv[i + 1]), 1));
+		}
+		else if(option == "--filter")
+		{
+			filter = argv[i + 1];
+		}
+	}
+
+	auto isWanted = [&filter](const string& name) { return filter.empty() || name.find(filter) != string::npos; };
+	auto report = [](const BenchmarkResult& result) { Benchmark::writeResult(cout, result); };
+
+	World world;
+	World::Scope scope(world);
+	world.setBounds(WORLD_SIZE);
+
+	vector<unique_ptr<Genome>> genomes;
+	vector<string> genomeTexts;
+	loadGenomes(genomes, genomeTexts);
+	if(genomes.empty())
+	{
+		cerr << "no genomes in " << DIR_GENOMES << " -- run from the repository root" << endl;
+		return -1;
+	}
+
+	Benchmark::writeHeader(cout);
+	string genomesParam = "genomes=" + to_string(genomes.size());
+
+	if(isWanted("network_evaluate"))
+	{
+		vector<unique_ptr<NeuralNetwork>> networks;
+		for(const auto& genome : genomes)
+		{
+			networks.emplace_back(new NeuralNetwork(Species::forGenome(genome->isPrey()).numInputs));
+			networks.back()->createNetwork(*genome);
+		}
+
+		vector<float> inputs(NETWORK_MAX_IN);
+		Random::fillRange(inputs.data(), inputs.size(), 0.0f, 1.0f);
+		float outputs[NETWORK_NUM_OUT];
+
+		report(Benchmark::measure("network_evaluate", genomesParam, networks.size() * NETWORK_EVALS_PER_GENOME, numReps, nullptr,
+			[&]()
+			{
+				for(auto& network : networks)
+				{
+					for(uint32_t i = 0; i < NETWORK_EVALS_PER_GENOME; ++i)
+					{
+						network->evaluate(inputs.data(), outputs);
+					}
+				}
+			}));
+	}
+
+	for(uint32_t numTargets : OBJECT_COUNTS)
+	{
+		if(!isWanted("perception_block") && !isWanted("perception_far") && !isWanted("find_contacts"))
+		{
+			break;
+		}
+
+		vector<unique_ptr<BenchAgent>> observers;
+		vector<unique_ptr<BenchAgent>> targets;
+		scatterAgents(numTargets, observers, targets);
+
+		string objectsParam = "objects=" + to_string(numTargets);
+		const CollisionRegistry::Lists& agents = PhysicalCircle::getCollisionObjLists(Agent::classTypeID());
+
+		if(isWanted("perception_block"))
+		{
+			report(Benchmark::measure("perception_block", objectsParam, NUM_OBSERVERS, numReps, nullptr,
+				[&]()
+				{
+					for(auto& observer : observers)
+					{
+						observer->updatePerceptionBlock(agents, 2);
+					}
+				}));
+		}
+
+		if(isWanted("perception_far"))
+		{
+			// rebuilt untimed before each rep -- a tick builds it once for every observer
+			FarFieldGrid farField(Agent::classTypeID(), FAR_FIELD_CELL_SIZE);
+			farField.setBounds(WORLD_SIZE);
+
+			for(float theta : FAR_FIELD_THETAS)
+			{
+				ostringstream param;
+				param << objectsParam << " theta=" << theta;
+
+				report(Benchmark::measure("perception_far", param.str(), NUM_OBSERVERS, numReps,
+					[&]()
+					{
+						farField.build(agents);
+					},
+					[&]()
+					{
+						for(auto& observer : observers)
+						{
+							observer->updatePerceptionBlock(farField, theta, 2);
+						}
+					}));
+			}
+		}
+
+		if(isWanted("find_contacts"))
+		{
+			// a tick's broad and narrow phase over every object, grid build included
+			vector<Contact> contacts;
+			report(Benchmark::measure("find_contacts", objectsParam, numTargets + NUM_OBSERVERS, numReps, nullptr,
+				[&]()
+				{
+					PhysicalCircle::findContacts(contacts);
+				}));
+		}
+	}
+
+	for(uint32_t numCones : CONE_COUNTS)
+	{
+		if(!isWanted("perception_cones"))
+		{
+			break;
+		}
+
+		// prey that see in more or fewer cones -- the table's limits are for genomes, not kernels
+		Species species = Species::get(Species::PREY);
+		species.numCones = numCones;
+		species.numInputs = species.numVisibleTypes * numCones + NETWORK_NUM_IN_STATUS + species.numScentTypes * Species::NUM_SCENT_SAMPLES;
+
+		vector<unique_ptr<BenchAgent>> observers;
+		vector<unique_ptr<BenchAgent>> targets;
+		scatterAgents(CONE_OBJECT_COUNT, observers, targets, species);
+
+		const CollisionRegistry::Lists& agents = PhysicalCircle::getCollisionObjLists(Agent::classTypeID());
+		report(Benchmark::measure("perception_cones", "cones=" + to_string(numCones), NUM_OBSERVERS, numReps, nullptr,
+			[&]()
+			{
+				for(auto& observer : observers)
+				{
+					observer->updatePerceptionBlock(agents, 2);
+				}
+			}));
+	}
+
+	if(isWanted("genome_crossover"))
+	{
+		report(Benchmark::measure("genome_crossover", genomesParam, GENOME_OPS_PER_REP, numReps, nullptr,
+			[&]()
+			{
+				for(uint32_t i = 0; i < GENOME_OPS_PER_REP; ++i)
+				{
+					const Genome& first = *genomes[i % genomes.size()];
+					const Genome& second = *genomes[(i + 1) % genomes.size()];
+					delete first.crossover(second, false);
+				}
+			}));
+	}
+
+	if(isWanted("genome_mutate"))
+	{
+		// mutation edits in place, so each rep mutates fresh copies
+		vector<unique_ptr<Genome>> copies;
+		report(Benchmark::measure("genome_mutate", genomesParam, GENOME_OPS_PER_REP, numReps,
+			[&]()
+			{
+				copies.clear();
+				for(uint32_t i = 0; i < GENOME_OPS_PER_REP; ++i)
+				{
+					copies.emplace_back(new Genome(*genomes[i % genomes.size()]));
+				}
+			},
+			[&]()
+			{
+				for(auto& copy : copies)
+				{
+					copy->mutate(0.5f);
+				}
+			}));
+	}
+
+	if(isWanted("genome_read"))
+	{
+		// parse from memory, so disk speed stays out of it
+		report(Benchmark::measure("genome_read", genomesParam, genomeTexts.size(), numReps, nullptr,
+			[&]()
+			{
+				for(const string& text : genomeTexts)
+				{
+					istringstream stream(text);
+
+					uint32_t id; bool usesNEAT, isPrey;
+					stream >> id >> usesNEAT >> isPrey;
+
+					Genome genome(id, Species::forGenome(isPrey).numInputs, usesNEAT, isPrey);
+					genome.readFromStream(stream);
+				}
+			}));
+	}
+
+	if(isWanted("event_queue_update"))
+	{
+		CountingSubscriber subscriber;
+		Event<ResourceDeactivate>::subscribe(subscriber);
+
+		report(Benchmark::measure("event_queue_update", "events=" + to_string(EVENTS_PER_REP), EVENTS_PER_REP, numReps,
+			[&]()
+			{
+				for(uint32_t i = 0; i < EVENTS_PER_REP; ++i)
+				{
+					EventQueue::enqueue(*new Event<ResourceDeactivate>(ResourceDeactivate{ SlotHandle() }));
+				}
+			},
+			[&]()
+			{
+				world.getEventQueue().update();
+			}));
+
+		Event<ResourceDeactivate>::unsubscribe(subscriber);
+	}
+
+	return 0;
+}
@@ -10,16 +10,16 @@
 #include "Resource.h"
 #include "ResourceEffects.h"
 
+#include "Environment.h"
+#include "GenomeCache.h"
+#include "World.h"
+
 using namespace Ecosim;
 using namespace std;
 using namespace glm;
 
 RTTI_DEFINITIONS(Agent)
 
-// perception subdivision constants
-const float PERCEPTION_SUBDIV_WIDTH = PI / PERCEPTION_NUM_VISION_CONES;
-const uint32_t PERCEPTION_HALF_SUBDIVS = PERCEPTION_NUM_VISION_CONES / 2;
-
 // neural network output array offsets
 const uint32_t OUTPUT_SPEED = 0;
 const uint32_t OUTPUT_STEER_L = 1;
@@ -33,38 +33,201 @@ const float MAX_HUNGER = 1.0f;
 const float MAX_THIRST = 1.0f;
 const float MAX_ENERGY = 1.0f;
 
+// scent is sampled either side of our facing, a little past our edge
+const float SCENT_SAMPLE_ANGLE = PI / 4.0f;
+const float SCENT_SAMPLE_REACH = 20.0f;
+// scent at which a scent input reads one half
+const float SCENT_HALF_INPUT = 1.0f;
+
 // misc constants
 const float DIGEST_EFFICIENCY = 0.97f;
 const float MOVE_COEF = 0.015f;
-
-// fitness weights
-const float FITNESS_WEIGHT_TIME = 0.8f;
-const float FITNESS_WEIGHT_HEALTH = 0.2f;
-const float FITNESS_WEIGHT_HUNGER = 0.15f;
-const float FITNESS_WEIGHT_THIRST = 0.15f;
-const float FITNESS_WEIGHT_ENERGY = 0.7f;
+const float COLLISION_PUSH_DISTANCE = 5.0f;
 
 // display constants
 const glm::vec3 SELECTED_COLOR = glm::vec3(0, 0.85f, 0);
 const float SELECTED_FLASH_DURATION = 0.6f;
 
+namespace
+{
+	/**	Sums the distance and number of objects seen in
+	 *	each cone of one perception block, then turns them
+	 *	into inputs. The cone count is fixed per
+	 *	instantiation, so the sums stay on the stack and
+	 *	the reset and normalize loops unroll.
+	 */
+	template <uint32_t NUM_CONES>
+	class ConeAccumulator final
+	{
+		static_assert(NUM_CONES % 2 == 0, "cones split evenly about the facing");
+
+	public:
+
+		ConeAccumulator(const vec3& position, const vec3& facing, float maxDist) :
+			mPosition(position),
+			mFacing(facing),
+			mMaxDist(maxDist)
+		{
+			for(uint32_t i = 0; i < NUM_CONES; ++i)
+			{
+				mSums[i] = maxDist;
+				mCounts[i] = 0;
+			}
+		}
+
+		/**	Adds a number of objects at one point -- more
+		 *	than one when a distant cluster stands in for them.
+		 */
+		void operator()(const vec3& target, uint32_t count)
+		{
+			// cones split the half circle in front of us
+			const uint32_t HALF_CONES = NUM_CONES / 2;
+			const float CONE_WIDTH = PI / NUM_CONES;
+
+			vec3 vectorBetween = target - mPosition;
+			float distanceBetween = glm::length(vectorBetween);
+			vectorBetween = glm::normalize(vectorBetween);
+
+			// check if current object is in our field of view
+			float dotProduct = glm::dot(mFacing, vectorBetween);
+			if(dotProduct >= 0.0f)
+			{
+				// get the discrete vision cone this object is in
+				vec3 crossProduct = glm::cross(mFacing, vectorBetween);
+				uint32_t offset = static_cast<uint32_t>(glm::acos(dotProduct) / CONE_WIDTH);
+
+				uint32_t visionConeID = crossProduct.z >= 0.0f ?
+					HALF_CONES + offset :
+					HALF_CONES - offset - 1;
+
+				if(visionConeID >= NUM_CONES)
+				{
+					visionConeID = 0;
+				}
+
+				// input is the sum of distances of objects in that region (we also count the number of objects)
+				mSums[visionConeID] += distanceBetween * static_cast<float>(count);
+				mCounts[visionConeID] += count;
+			}
+		}
+
+		/**	Writes the average distance in each cone,
+		 *	normalized against the maximum distance.
+		 */
+		void write(float* outBlock) const
+		{
+			for(uint32_t i = 0; i < NUM_CONES; ++i)
+			{
+				float input = mSums[i];
+				if(mCounts[i] != 0)
+				{
+					input -= mMaxDist;
+					input /= mCounts[i];
+				}
+
+				outBlock[i] = input / -mMaxDist + 1.0f;
+			}
+		}
+
+	private:
+
+		const vec3& mPosition;
+		const vec3& mFacing;
+		float mMaxDist;
+
+		float mSums[NUM_CONES];
+		uint32_t mCounts[NUM_CONES];
+	};
+
+	//=============================================================
+
+	/**	Fills one perception block by scanning every
+	 *	object of a type.
+	 */
+	template <uint32_t NUM_CONES>
+	void perceiveCones(const CollisionRegistry::Lists& objects, const PhysicalCircle& self, const vec3& facing, float maxDist, float* outBlock)
+	{
+		ConeAccumulator<NUM_CONES> cones(self.getPosition(), facing, maxDist);
+		for(const CollisionRegistry::Members* members : objects)
+		{
+			for(PhysicalCircle* collisionObj : *members)
+			{
+				// skip if object if collision is inactive
+				if(collisionObj->isCollisionActive() && collisionObj != &self)
+				{
+					cones(collisionObj->getPosition(), 1);
+				}
+			}
+		}
+
+		cones.write(outBlock);
+	}
+
+	//-------------------------------------------------------------
+
+	/**	Fills one perception block from a far-field summary,
+	 *	seeing distant cells as clusters.
+	 */
+	template <uint32_t NUM_CONES>
+	void perceiveCones(const FarFieldGrid& farField, float theta, const PhysicalCircle& self, const vec3& facing, float maxDist, float* outBlock)
+	{
+		ConeAccumulator<NUM_CONES> cones(self.getPosition(), facing, maxDist);
+		farField.visit(self.getPosition(), theta, &self, cones);
+		cones.write(outBlock);
+	}
+
+	//-------------------------------------------------------------
+
+	/**	Picks the kernel for a cone count.
+	 */
+	template <typename... Args>
+	void dispatchPerception(uint32_t numCones, Args&&... args)
+	{
+		switch(numCones)
+		{
+		case 4:
+			perceiveCones<4>(std::forward<Args>(args)...);
+			break;
+
+		case 8:
+			perceiveCones<8>(std::forward<Args>(args)...);
+			break;
+
+		case 16:
+			perceiveCones<16>(std::forward<Args>(args)...);
+			break;
+
+		case 32:
+			perceiveCones<32>(std::forward<Args>(args)...);
+			break;
 
-Agent::Agent(uint32_t numInputs, const glm::vec3& color, const glm::vec3& pos, const glm::vec3& facing) :
+		default:
+			assert(false);
+			break;
+		}
+	}
+}
+
+//-------------------------------------------------------------
+
+Agent::Agent(const Species& species, const glm::vec3& pos, const glm::vec3& facing) :
 	PhysicalCircle(0.0f, pos),
-	mColor(color),
-	mUnselectedColor(color),
-	mBrain(new NeuralNetwork(numInputs)),
+	mSpecies(&species),
+	mColor(species.color),
+	mUnselectedColor(species.color),
+	mBrain(new NeuralNetwork(species.numInputs)),
 	mDNA(nullptr),
 	mIsAlive(true),
-	mIsSelected(false)
+	mIsSelected(false),
+	mThinksThisTick(true)
 {
-	// verifying values for the input block
-	//		we get the number of perception blocks, then set the last 3 inputs to status
-	assert(numInputs >= NETWORK_MIN_IN && numInputs <= NETWORK_MAX_IN);
-	mNumPerceptionBlocks = (numInputs - NETWORK_NUM_IN_STATUS) / PERCEPTION_NUM_VISION_CONES;
-	INPUT_ENERGY = numInputs - 1;
-	INPUT_THIRST = numInputs - 2;
-	INPUT_HUNGER = numInputs - 3;
+	// one perception block per visible type, then 3 status inputs, then scent
+	uint32_t numInputs = species.numInputs;
+	mNumPerceptionBlocks = species.numVisibleTypes;
+	INPUT_HUNGER = mNumPerceptionBlocks * species.numCones;
+	INPUT_THIRST = INPUT_HUNGER + 1;
+	INPUT_ENERGY = INPUT_HUNGER + 2;
+	mFirstScentInput = INPUT_HUNGER + NETWORK_NUM_IN_STATUS;
 
 	// register this object, create input and output blocks
 	registerObj(*this);
@@ -78,7 +241,7 @@ Agent::Agent(uint32_t numInputs, const glm::vec3& color, const glm::vec3& pos, c
 
 Agent::~Agent()
 {
-	unregisterObj(*this);
+	TimerWheel::cancel(mLifetimeTimer);
 
 	delete mBrain;
 	delete mDNA;
@@ -100,20 +263,25 @@ void Agent::activate()
 	mMaxSpeed = SimMath::moveSpeedFromSize(mSize);
 	mMaxSteer = SimMath::steerSpeedFromSize(mSize);
 
-	mInputs[INPUT_HUNGER] = Random::randomRange(MAX_HUNGER * 0.9f, MAX_HUNGER);
-	mInputs[INPUT_THIRST] = Random::randomRange(MAX_THIRST * 0.9f, MAX_THIRST);
-	mInputs[INPUT_ENERGY] = Random::randomRange(MAX_ENERGY * 0.9f, MAX_ENERGY);
+	mInputs[INPUT_HUNGER] = mRng.range(MAX_HUNGER * 0.9f, MAX_HUNGER);
+	mInputs[INPUT_THIRST] = mRng.range(MAX_THIRST * 0.9f, MAX_THIRST);
+	mInputs[INPUT_ENERGY] = mRng.range(MAX_ENERGY * 0.9f, MAX_ENERGY);
 
 	mTimeAlive = 0.0f;
+	mTicksAlive = 0;
 	mIsAlive = true;
 
+	// die of old age unless something else gets us first
+	TimerWheel::cancel(mLifetimeTimer);
+	mLifetimeTimer = TimerWheel::schedule(MAX_LIFETIME, [this]() { kill(); });
+
 	// reset collision
 	activateCollision();
 	setRadius(mSize);
 
 	// set new position
 	const glm::vec2& bounds = getBounds();
-	setPosition(glm::vec3(Random::randomRange(0.0f, bounds.x), Random::randomRange(0.0f, bounds.y), 0.0f));
+	setPosition(glm::vec3(mRng.range(0.0f, bounds.x), mRng.range(0.0f, bounds.y), 0.0f));
 
 	// create neural network using genome
 	mBrain->createNetwork(*mDNA);
@@ -122,26 +290,37 @@ void Agent::activate()
 //-------------------------------------------------------------
 
 void Agent::update(const SimClock& clock)
+{
+	think(clock);
+
+	// dying posts an event, so it can't happen inside think
+	if(mIsAlive && hasStarved())
+	{
+		kill();
+	}
+}
+
+//-------------------------------------------------------------
+
+void Agent::think(const SimClock& clock)
 {
 	if(mIsAlive)
 	{
 		float deltaSecondsScaled = clock.getDeltaTimeScaled();
 
-		// update perception and status
+		// update status -- perception was filled in before any Agent moved
 		updateStatusInputs(deltaSecondsScaled);
-		updatePerceptionInputs();
 
-		// evaluate move controls and update collisions
-		mBrain->evaluate(mInputs, mOutputs);
+		// evaluate move controls, or steer as we last decided -- collisions are handled once every Agent has moved
+		if(mThinksThisTick)
+		{
+			mBrain->evaluate(mInputs, mOutputs);
+		}
 		applyMovement(deltaSecondsScaled);
-		updateCollisions();
 
-		// update age, kill if too old
+		// update age -- the lifetime timer handles death by old age
 		mTimeAlive += deltaSecondsScaled;
-		if(mTimeAlive >= MAX_LIFETIME)
-		{
-			kill();
-		}
+		++mTicksAlive;
 
 		// update flashing timer if selected
 		if(mIsSelected)
@@ -158,127 +337,180 @@ void Agent::update(const SimClock& clock)
 
 //-------------------------------------------------------------
 
-void Agent::updatePerceptionInputs()
+void Agent::updatePerception(const Species& species, const vector<Agent*>& agents)
 {
-	// we can see and collide with food, water, and other agents
-	updatePerceptionBlock(Resource<Food>::classTypeID(), 0);
-	updatePerceptionBlock(Resource<Water>::classTypeID(), 1);
-	updatePerceptionBlock(Agent::classTypeID(), 2);
+	World& world = World::current();
+	const SimParams& params = world.getConfig().params;
+	float theta = params.perceptionTheta;
+
+	// nothing has moved yet, so every Agent decides against the same world
+	const SpatialGrid& spatialIndex = getSpatialIndex();
+	for(Agent* agent : agents)
+	{
+		agent->mThinksThisTick = agent->mIsAlive && agent->isThinkDue(params, spatialIndex);
+	}
+
+	// look up each type's lists once for the whole species
+	for(uint32_t block = 0; block < species.numVisibleTypes; ++block)
+	{
+		uint64_t typeID = species.visibleTypes[block]();
+		const CollisionRegistry::Lists& objects = getCollisionObjLists(typeID);
+		const FarFieldGrid* farField = theta > 0.0f ? world.findFarField(typeID) : nullptr;
+
+		for(Agent* agent : agents)
+		{
+			assert(agent->mSpecies == &species);
+			if(!agent->mThinksThisTick)
+			{
+				continue;
+			}
+
+			if(farField != nullptr)
+			{
+				agent->updatePerceptionBlock(*farField, theta, block);
+			}
+			else
+			{
+				agent->updatePerceptionBlock(objects, block);
+			}
+		}
+	}
+
+	// scent costs a lookup per sample, however many objects left it
+	const Environment& environment = world.getEnvironment();
+	for(uint32_t i = 0; i < species.numScentTypes; ++i)
+	{
+		const ScentField* field = environment.findScentField(species.scentTypes[i]());
+		assert(field != nullptr);
+
+		for(Agent* agent : agents)
+		{
+			if(agent->mThinksThisTick)
+			{
+				agent->sampleScent(*field, i);
+			}
+		}
+	}
 }
 
 //-------------------------------------------------------------
 
-void Agent::updateCollisions()
+void Agent::updateCollisions(const vector<Contact>& contacts)
 {
-	detectCollisions(Resource<Water>::classTypeID());
-	detectCollisions(Resource<Food>::classTypeID());
-	detectCollisions(Agent::classTypeID());
+	for(const Contact& contact : contacts)
+	{
+		// either side may be an Agent that cares about the other
+		Agent* first = contact.first->as<Agent>();
+		if(first != nullptr && first->collidesWith(*contact.second))
+		{
+			first->resolveContact(*contact.second, -contact.normal);
+		}
+
+		Agent* second = contact.second->as<Agent>();
+		if(second != nullptr && second->collidesWith(*contact.first))
+		{
+			second->resolveContact(*contact.first, contact.normal);
+		}
+	}
+}
+
+//-------------------------------------------------------------
+
+void Agent::updatePerceptionBlock(const CollisionRegistry::Lists& objects, uint32_t perceptionBlockID)
+{
+	// are we in bounds for the perception data?
+	if(perceptionBlockID < mNumPerceptionBlocks)
+	{
+		const uint32_t numCones = mSpecies->numCones;
+		dispatchPerception(numCones, objects, *this, mFacing, getMaxDistance(), mInputs + numCones * perceptionBlockID);
+	}
 }
 
 //-------------------------------------------------------------
 
-void Agent::updatePerceptionBlock(uint64_t typeID, uint32_t perceptionBlockID)
+void Agent::updatePerceptionBlock(const FarFieldGrid& farField, float theta, uint32_t perceptionBlockID)
 {
 	// are we in bounds for the perception data?
 	if(perceptionBlockID < mNumPerceptionBlocks)
 	{
-		// declaring here so we don't have to constantly redo it inside the loop
-		uint32_t visionConeID;
-		uint32_t numObjsPerCone[PERCEPTION_NUM_VISION_CONES];
-		float dotProduct;
-		float angleBetween;
-		float distanceBetween;
-		float maxDist = getMaxDistance();
-		glm::vec3 crossProduct;
-		glm::vec3 vectorBetween;
-
-		// reset perception data in this perception block
-		uint32_t blockID = PERCEPTION_NUM_VISION_CONES * perceptionBlockID;
-		for(uint32_t i = 0; i < PERCEPTION_NUM_VISION_CONES; ++i)
+		const uint32_t numCones = mSpecies->numCones;
+		dispatchPerception(numCones, farField, theta, *this, mFacing, getMaxDistance(), mInputs + numCones * perceptionBlockID);
+	}
+}
+
+//-------------------------------------------------------------
+
+bool Agent::collidesWith(const PhysicalCircle& other) const
+{
+	for(uint32_t i = 0; i < mSpecies->numCollidableTypes; ++i)
+	{
+		if(other.is(mSpecies->collidableTypes[i]()))
 		{
-			mInputs[blockID + i] = maxDist;
-			numObjsPerCone[i] = 0;
+			return true;
 		}
+	}
 
-		// check each collidable object of the given type
-		for(PhysicalCircle* collisionObj : getCollisionObjList(typeID))
-		{
-			// skip if object if collision is inactive
-			if(!collisionObj->isCollisionActive() || collisionObj == this)
-			{
-				continue;
-			}
+	return false;
+}
 
-			vectorBetween = collisionObj->getPosition() - mPosition;
-			distanceBetween = glm::length(vectorBetween);
-			vectorBetween = glm::normalize(vectorBetween);
+//-------------------------------------------------------------
 
-			// check if current object is in our field of view
-			dotProduct = glm::dot(mFacing, vectorBetween);
-			if(dotProduct >= 0.0f)
-			{
-				// get the discrete vision cone this object is in
-				crossProduct = glm::cross(mFacing, vectorBetween);
-				angleBetween = glm::acos(dotProduct);
+void Agent::resolveContact(PhysicalCircle& other, const vec3& away)
+{
+	// an earlier contact this tick may have killed us or used the other up
+	if(mIsAlive && isCollisionActive() && other.isCollisionActive())
+	{
+		other.handleCollision(*this);
+		mPosition += away * COLLISION_PUSH_DISTANCE;
+	}
+}
 
-				visionConeID = crossProduct.z >= 0.0f ?
-					PERCEPTION_HALF_SUBDIVS + static_cast<uint32_t>(angleBetween / PERCEPTION_SUBDIV_WIDTH) :
-					PERCEPTION_HALF_SUBDIVS - static_cast<uint32_t>(angleBetween / PERCEPTION_SUBDIV_WIDTH) - 1;
+//-------------------------------------------------------------
 
-				if(visionConeID >= PERCEPTION_NUM_VISION_CONES)
-				{
-					visionConeID = 0;
-				}
+bool Agent::isThinkDue(const SimParams& params, const SpatialGrid& spatialIndex) const
+{
+	uint32_t maxInterval = static_cast<uint32_t>(std::max(params.thinkIntervalMax, 1.0f));
+	if(maxInterval == 1 || mTicksAlive == 0)
+	{
+		return true;
+	}
 
-				// input is the sum of distances of objects in that region (we also count the number of objects)
-				mInputs[blockID + visionConeID] += distanceBetween;
-				++numObjsPerCone[visionConeID];
-			}
+	// with no energy we can't move, so there's nothing to decide
+	if(mInputs[INPUT_ENERGY] > 0.0f)
+	{
+		if(params.thinkFastSpeed > 0.0f && glm::abs(mOutputs[OUTPUT_SPEED]) >= params.thinkFastSpeed)
+		{
+			return true;
 		}
 
-		// dividing total distances by number of objects to get the average distance of things in each region
-		//		then normalizing against the maximum distance
-		for(uint32_t i = 0; i < PERCEPTION_NUM_VISION_CONES; ++i)
+		if(params.thinkNearDistance > 0.0f && spatialIndex.hasObjectNear(vec2(mPosition), mSize + params.thinkNearDistance, this))
 		{
-			uint32_t inputIndex = blockID + i;
-			if(numObjsPerCone[i] != 0)
-			{
-				mInputs[inputIndex] -= maxDist;
-				mInputs[inputIndex] /= numObjsPerCone[i];
-			}
-
-			mInputs[inputIndex] /= -maxDist;
-			++mInputs[inputIndex];
+			return true;
 		}
 	}
+
+	// the handle sets each Agent's phase, so idle ones think on different ticks
+	return (mTicksAlive + getHandle().index) % maxInterval == 0;
 }
 
 //-------------------------------------------------------------
 
-void Agent::detectCollisions(uint64_t typeID)
+void Agent::sampleScent(const ScentField& field, uint32_t scentID)
 {
-	float distanceBetween;
-	glm::vec3 vectorBetween;
+	float* samples = mInputs + mFirstScentInput + scentID * Species::NUM_SCENT_SAMPLES;
+	float reach = mSize + SCENT_SAMPLE_REACH;
 
-	// check each collidable object of the given type
-	for(PhysicalCircle* collisionObj : getCollisionObjList(typeID))
+	// ahead-left, then ahead-right
+	const float angles[Species::NUM_SCENT_SAMPLES] = { SCENT_SAMPLE_ANGLE, -SCENT_SAMPLE_ANGLE };
+	for(uint32_t i = 0; i < Species::NUM_SCENT_SAMPLES; ++i)
 	{
-		// skip if object if collision is inactive
-		if(!collisionObj->isCollisionActive() || collisionObj == this)
-		{
-			continue;
-		}
-
-		vectorBetween = collisionObj->getPosition() - mPosition;
-		distanceBetween = glm::length(vectorBetween);
-		vectorBetween = glm::normalize(vectorBetween);
+		float cosAngle = std::cos(angles[i]);
+		float sinAngle = std::sin(angles[i]);
+		vec3 direction(mFacing.x * cosAngle - mFacing.y * sinAngle, mFacing.x * sinAngle + mFacing.y * cosAngle, 0.0f);
 
-		// handle collisions if we're close enough to the object
-		if(distanceBetween < getRadius() + collisionObj->getRadius())
-		{
-			collisionObj->handleCollision(*this);
-			mPosition = mPosition - (vectorBetween * 5.0f);
-		}
+		// squash the unbounded concentration into [0, 1)
+		float scent = field.sample(mPosition + direction * reach);
+		samples[i] = scent / (scent + SCENT_HALF_INPUT);
 	}
 }
 
@@ -298,11 +530,14 @@ void Agent::updateStatusInputs(float deltaSeconds)
 		mInputs[INPUT_ENERGY] = MAX_ENERGY;
 	}
 
-	// flag for death if we starve or dehydrate
-	if(mInputs[INPUT_HUNGER] < 0.0f || mInputs[INPUT_THIRST] < 0.0f)
-	{
-		kill();
-	}
+}
+
+//-------------------------------------------------------------
+
+bool Agent::hasStarved() const
+{
+	// dead if we starve or dehydrate
+	return mInputs[INPUT_HUNGER] < 0.0f || mInputs[INPUT_THIRST] < 0.0f;
 }
 
 //-------------------------------------------------------------
@@ -339,32 +574,43 @@ void Agent::applyMovement(float deltaSeconds)
 
 //-------------------------------------------------------------
 
-void Agent::render(Renderer& renderer)
+void Agent::render(DrawList& drawList)
 {
 	if(mIsAlive)
 	{
 #if DRAWS_VISION_CONES
-		float angle = PERCEPTION_HALF_SUBDIVS * PERCEPTION_SUBDIV_WIDTH;
-		for(float i = angle; i >= -angle - 0.01f; i -= PERCEPTION_SUBDIV_WIDTH)
+		float coneWidth = PI / mSpecies->numCones;
+		float angle = (mSpecies->numCones / 2) * coneWidth;
+		for(float i = angle; i >= -angle - 0.01f; i -= coneWidth)
 		{
 			vec3 v = vec3(mFacing.x * std::cos(i) + mFacing.y * std::sin(i), -mFacing.x * std::sin(i) + mFacing.y * std::cos(i), 0);
 			v = glm::normalize(v);
 
-			renderer.drawRay(mPosition + v * mSize, v, 1000.0f, vec3(1, 0, 0));
+			drawList.drawRay(mPosition + v * mSize, v, 1000.0f, vec3(1, 0, 0));
 		}
 #endif
 
-		renderer.drawColoredCircle(mPosition, mSize, mColor);
-		renderer.drawRay(mPosition, mFacing, mSize, vec3(0, 0, 0));
+		drawList.drawColoredCircle(mPosition, mSize, mColor);
+		drawList.drawRay(mPosition, mFacing, mSize, vec3(0, 0, 0));
 	}
 }
 
 //-------------------------------------------------------------
 
-void Agent::drawNetwork(Renderer& renderer)
+void Agent::hashState(StateHash& hash) const
 {
-	assert(mBrain != nullptr);
-	mBrain->render(renderer);
+	hash.add(static_cast<uint64_t>(mIsAlive));
+	hash.add(mPosition);
+	hash.add(mFacing);
+	hash.add(mSize);
+	hash.add(mTimeAlive);
+
+	hash.add(mInputs, mBrain->getNumInputs());
+	hash.add(mOutputs, NETWORK_NUM_OUT);
+
+	hash.add(static_cast<uint64_t>(mDNA->getID()));
+	hash.add(mDNA->getSizeGene());
+	hash.add(mDNA->getGeneHash());
 }
 
 //-------------------------------------------------------------
@@ -393,11 +639,12 @@ void Agent::updateThirst(float amount)
 
 void Agent::kill()
 {
+	TimerWheel::cancel(mLifetimeTimer);
 	deactivateCollision();
 	mIsAlive = false;
 
 	AgentDeath args;
-	args.agent = this;
+	args.agent = getHandle();
 	EventQueue::enqueue(*new Event<AgentDeath>(args));
 }
 
@@ -433,6 +680,9 @@ void Agent::setGenome(Genome& genome)
 	// takes possession of incoming genome
 	delete mDNA;
 	mDNA = &genome;
+
+	// share genes with any identical genome already alive
+	GenomeCache::instance()->internGenes(*mDNA);
 }
 
 //-------------------------------------------------------------
@@ -460,6 +710,27 @@ const Genome& Agent::getGenome() const
 
 //-------------------------------------------------------------
 
+const Species& Agent::getSpecies() const
+{
+	return *mSpecies;
+}
+
+//-------------------------------------------------------------
+
+void Agent::setRng(const Rng& rng)
+{
+	mRng = rng;
+}
+
+//-------------------------------------------------------------
+
+Rng& Agent::getRng()
+{
+	return mRng;
+}
+
+//-------------------------------------------------------------
+
 float Agent::getInputValue(std::uint32_t index) const
 {
 	assert(mBrain != nullptr);
@@ -479,12 +750,14 @@ float Agent::getOutputValue(std::uint32_t index) const
 
 float Agent::getFitness() const
 {
+	const SimParams& params = World::current().getConfig().params;
+
 	return
-		FITNESS_WEIGHT_TIME * (mTimeAlive / MAX_LIFETIME) +
-		FITNESS_WEIGHT_HEALTH * (
-			FITNESS_WEIGHT_HUNGER * mInputs[INPUT_HUNGER] +
-			FITNESS_WEIGHT_THIRST * mInputs[INPUT_THIRST] +
-			FITNESS_WEIGHT_ENERGY * mInputs[INPUT_ENERGY]);
+		params.fitnessWeightTime * (mTimeAlive / MAX_LIFETIME) +
+		params.fitnessWeightHealth * (
+			params.fitnessWeightHunger * mInputs[INPUT_HUNGER] +
+			params.fitnessWeightThirst * mInputs[INPUT_THIRST] +
+			params.fitnessWeightEnergy * mInputs[INPUT_ENERGY]);
 }
 
 //-------------------------------------------------------------
@@ -500,3 +773,10 @@ bool Agent::isSelected() const
 {
 	return mIsSelected;
 }
+
+//-------------------------------------------------------------
+
+bool Agent::isThinking() const
+{
+	return mThinksThisTick;
+}
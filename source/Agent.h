@@ -2,16 +2,36 @@
 #pragma once
 
 #include "PhysicalCircle.h"
+#include "FarFieldGrid.h"
+#include "ScentField.h"
 
 #include "Genome.h"
 #include "NeuralNetwork.h"
+#include "Species.h"
+#include "TimerWheel.h"
+#include "StateHash.h"
 
 namespace Ecosim
 {
+	struct SimParams;
+
 	/** A movable object that has a Genome and NeuralNetwork.
 	 *	The NeuralNetwork drives the Agent's steering behavior.
 	 *	The Genome evolves over time based on the fitness of
 	 *	its Agent at the time of death.
+	 *
+	 *	What an Agent sees and collides with comes from its
+	 *	Species. Perception and collisions run for a whole
+	 *	species at once, before and after every Agent's
+	 *	update, so each Agent sees the world as the previous
+	 *	tick left it. Besides its vision cones, a species
+	 *	may smell the ScentFields of some types.
+	 *
+	 *	Perception also settles whether each Agent thinks
+	 *	this tick. One with nothing to react to may skip
+	 *	its perception and network for a few ticks, as the
+	 *	World's params allow, and steer by the outputs it
+	 *	last worked out.
 	 */
 	class Agent : public PhysicalCircle
 	{
@@ -26,12 +46,12 @@ namespace Ecosim
 
 		/**	@brief Constructor.
 		 *
-		 *	@param numInputs The number of inputs in the NeuralNetwork.
-		 *	@param color The default color of the Agent.
+		 *	@param species The Agent's species. Sets its inputs
+		 *				   and default color.
 		 *	@param pos The starting position.
 		 *	@param facing The starting direction the Agent faces.
 		 */
-		Agent(std::uint32_t numInputs = AGENT_NUM_INPUTS, const glm::vec3& color = AGENT_COLOR, const glm::vec3& pos = glm::vec3(0, 0, 0), const glm::vec3& facing = glm::vec3(0, 1, 0));
+		Agent(const Species& species = Species::get(Species::AGENT), const glm::vec3& pos = glm::vec3(0, 0, 0), const glm::vec3& facing = glm::vec3(0, 1, 0));
 
 		/**	@brief Destructor.
 		 */
@@ -45,23 +65,60 @@ namespace Ecosim
 
 		/**	@brief Updates the Agent. Updates status variables,
 		 *		   calculates network output, updates position
-		 *		   and rotation.
+		 *		   and rotation. Perception and collisions are
+		 *		   run around this by the species kernels.
 		 *
 		 *	@param clock The simulation's timekeeper.
 		 */
 		virtual void update(const SimClock& clock) override;
 
+		/**	@brief The part of an update that touches only
+		 *		   this Agent: status, network output, and
+		 *		   movement. Safe to run for many Agents at
+		 *		   once. Unlike update, leaves a starved
+		 *		   Agent alive for the caller to kill.
+		 *
+		 *	@param clock The simulation's timekeeper.
+		 */
+		void think(const SimClock& clock);
+
+		/**	@brief Checks whether the Agent has run out of
+		 *		   food or water.
+		 *
+		 *	@return Returns true if hunger or thirst is below 0.
+		 */
+		bool hasStarved() const;
+
+		/**	@brief Settles which living Agents of a species
+		 *		   think this tick, then fills their perception
+		 *		   inputs, one visible type at a time.
+		 *
+		 *	@param species The species of every Agent given.
+		 *	@param agents The Agents to update.
+		 */
+		static void updatePerception(const Species& species, const std::vector<Agent*>& agents);
+
+		/**	@brief Handles a tick's contacts in the order
+		 *		   given. Each side of a pair that is an Agent
+		 *		   able to collide with the other resolves it.
+		 *
+		 *	@param contacts Every overlapping pair, once each.
+		 */
+		static void updateCollisions(const std::vector<Contact>& contacts);
+
 		/** @brief Renders the Agent.
 		 *
-		 *	@param renderer The simulation rendering object.
+		 *	@param drawList The frame being drawn.
 		 */
-		virtual void render(Renderer& renderer) override;
+		virtual void render(DrawList& drawList) override;
 
-		/**	@brief Renders the Agent's NeuralNetwork.
+		/**	@brief Mixes the Agent's position, facing, status,
+		 *		   NeuralNetwork inputs and outputs, and Genome
+		 *		   into a hash.
 		 *
-		 *	@param renderer The simulation rendering object.
+		 *	@param hash The hash being built.
 		 */
-		void drawNetwork(Renderer& renderer);
+		void hashState(StateHash& hash) const;
 
 		/**	@brief Increases the "fullness" of the Agent.
 		 *
@@ -99,7 +156,8 @@ namespace Ecosim
 		 *	@param genome The new Genome.
 		 *
 		 *	@note The old Genome is destroyed. The Agent takes
-		 *		  possession of the new Genome.
+		 *		  possession of the new Genome, and its Genes are
+		 *		  interned with the GenomeCache.
 		 */
 		void setGenome(Genome& genome);
 
@@ -121,6 +179,25 @@ namespace Ecosim
 		 */
 		const Genome& getGenome() const;
 
+		/** @brief Gets the Agent's species.
+		 *
+		 *	@return Returns the table entry of mSpecies.
+		 */
+		const Species& getSpecies() const;
+
+		/**	@brief Gives the Agent its own random stream.
+		 *
+		 *	@param rng The stream. Copied.
+		 */
+		void setRng(const Rng& rng);
+
+		/**	@brief Gets the Agent's random stream. Used for
+		 *		   respawning, and for breeding its Genomes.
+		 *
+		 *	@return Returns mRng.
+		 */
+		Rng& getRng();
+
 		/** @brief Gets a value from the Agent's inputs.
 		 *
 		 *	@param index The offset into the input array.
@@ -169,52 +246,88 @@ namespace Ecosim
 		 */
 		bool isSelected() const;
 
-	protected:
-
-		/**	@brief Calls to update individual blocks of
-		 *		   perception input for several types.
+		/**	@brief Says whether the Agent runs its network
+		 *		   this tick, or holds its last outputs.
 		 *
-		 *	@note In order to easily handle different perception
-		 *		  behaviors for different Agent types, this
-		 *		  virtual function allows us to easily request
-		 *		  updates to perception data for specific types
-		 *		  and at specific blocks.
+		 *	@return Returns mThinksThisTick, as perception
+		 *			last left it.
 		 */
-		virtual void updatePerceptionInputs();
+		bool isThinking() const;
+
+	protected:
 
-		/**	@brief Calls to detect and handle collisions
-		 *		   with several types.
+		/** @brief Updates a specific block of perception input
+		 *		   for a given type.
 		 *
-		 *	@note In order to easily handle different collision
-		 *		  behaviors for different Agent types, this
-		 *		  virtual function allows us to easily request
-		 *		  updates to collision for specific types and at 
-		 *		  specific blocks.
+		 *	@param objects The registered objects of a type
+		 *				   that this Agent can see.
+		 *	@param perceptionBlockID The ID of the block of
+		 *							 perception data we are updating.
 		 */
-		virtual void updateCollisions();
+		void updatePerceptionBlock(const CollisionRegistry::Lists& objects, std::uint32_t perceptionBlockID);
 
 		/** @brief Updates a specific block of perception input
-		 *		   for a given type.
+		 *		   for a given type, seeing distant objects
+		 *		   as clusters.
 		 *
-		 *	@param typeID The type ID of a PhysicalCircle class
-		 *				  that this Agent can see.
+		 *	@param farField The summary of a type that this
+		 *					Agent can see.
+		 *	@param theta The opening threshold. Larger is faster
+		 *				 and less exact.
 		 *	@param perceptionBlockID The ID of the block of
 		 *							 perception data we are updating.
 		 */
-		void updatePerceptionBlock(std::uint64_t typeID, std::uint32_t perceptionBlockID);
+		void updatePerceptionBlock(const FarFieldGrid& farField, float theta, std::uint32_t perceptionBlockID);
+
+		/**	@brief Checks whether this Agent's species
+		 *		   collides with an object's type.
+		 *
+		 *	@param other The object.
+		 *
+		 *	@return Returns true if the object is of one of
+		 *			the species' collidable types.
+		 */
+		bool collidesWith(const PhysicalCircle& other) const;
 
-		/**	@brief Updates collisions for a given type.
+		/**	@brief Has an object handle a collision with this
+		 *		   Agent, then pushes this Agent away from it.
+		 *		   Does nothing if either side has already
+		 *		   been taken out of play this tick.
 		 *
-		 *	@param typeID The type ID of a PhysicalCircle class
-		 *				  that this Agent can collide with.
+		 *	@param other The object touched.
+		 *	@param away Unit vector from the object toward
+		 *				this Agent.
 		 */
-		void detectCollisions(std::uint64_t typeID);
+		void resolveContact(PhysicalCircle& other, const glm::vec3& away);
 
 	private:
 
+		/**	@brief Decides whether the Agent needs to think
+		 *		   this tick. A newborn always does, as does
+		 *		   one that is moving fast or has an object
+		 *		   near. Any other waits out the longest
+		 *		   interval, staggered by handle so they
+		 *		   don't all think on the same tick.
+		 *
+		 *	@param params The World's params.
+		 *	@param spatialIndex The objects as last tick
+		 *						left them.
+		 *
+		 *	@return Returns true if the Agent should think.
+		 */
+		bool isThinkDue(const SimParams& params, const SpatialGrid& spatialIndex) const;
+
+		/**	@brief Fills the scent inputs for one type from
+		 *		   points ahead-left and ahead-right of us.
+		 *
+		 *	@param field The type's ScentField.
+		 *	@param scentID The index of the type in our
+		 *				   species' scent list.
+		 */
+		void sampleScent(const ScentField& field, std::uint32_t scentID);
+
 		/**	@brief Updates the hunger, thirst, and energy inputs
-		 *		   that are fed to the NeuralNetwork. The Agent
-		 *		   dies if any of these hit 0.
+		 *		   that are fed to the NeuralNetwork.
 		 *
 		 *	@param deltaSeconds The scaled delta time for this frame.
 		 */
@@ -233,9 +346,12 @@ namespace Ecosim
 		std::uint32_t INPUT_HUNGER;
 		std::uint32_t INPUT_THIRST;
 		std::uint32_t INPUT_ENERGY;
+		std::uint32_t mFirstScentInput;
 
 	private:
 
+		const Species* mSpecies;
+
 		glm::vec3 mFacing;
 		glm::vec3 mColor;
 		glm::vec3 mUnselectedColor;
@@ -247,8 +363,12 @@ namespace Ecosim
 		float* mOutputs;
 
 		float mTimeAlive;
+		std::uint32_t mTicksAlive;
 		float mFlashingTimer;
 
+		TimerHandle mLifetimeTimer;
+		Rng mRng;
+
 		float mSize;
 		float mMaxSpeed;
 		float mMaxSteer;
@@ -257,5 +377,6 @@ namespace Ecosim
 
 		bool mIsAlive;
 		bool mIsSelected;
+		bool mThinksThisTick;
 	};
 }
@@ -7,6 +7,9 @@
 
 #include "EventArgs.h"
 #include "Event.h"
+#include "World.h"
+
+#include <algorithm>
 
 using namespace std::experimental::filesystem;
 using namespace Ecosim;
@@ -14,6 +17,7 @@ using namespace std;
 using namespace glm;
 
 AgentManager::AgentManager() :
+	mNumAgentsCreated(0),
 	mAllowsMutation(true),
 	mDrawsNetwork(false)
 {
@@ -31,104 +35,303 @@ AgentManager::~AgentManager()
 
 void AgentManager::init()
 {
-	// for each genome ini file...
-	for(auto& file : directory_iterator(DIR_GENOMES))
-	{
-		// read genome header information
-		ifstream genomeFile;
-		genomeFile.open(file.path().c_str(), ifstream::in);
+	const vector<SpeciesConfig>& species = World::current().getConfig().species;
 
-		uint32_t id; bool usesNEAT, isPrey;
-		genomeFile >> id >> usesNEAT >> isPrey;
-
-#if USES_PREDATOR_PREY
-		// create agent of the appropriate type
-		Genome* genome = new Genome(id, isPrey ? PREY_NUM_INPUTS : PREDATOR_NUM_INPUTS, usesNEAT, isPrey);
-		Agent* agent = isPrey ? new Prey() : nullptr;
-		if(agent == nullptr)
+	// parse each species' template first, so the counters see its genes
+	vector<unique_ptr<Genome>> templates;
+	if(species.empty())
+	{
+		loadGenomeFiles();
+	}
+	else
+	{
+		for(const SpeciesConfig& speciesConfig : species)
 		{
-			agent = new Predator();
+			istringstream genomeStream(speciesConfig.genome);
+			templates.emplace_back(speciesConfig.genome.empty() ? nullptr : readGenome(genomeStream, true, nullptr));
 		}
-#else
-		// create agent
-		Genome* genome = new Genome(id, NETWORK_MAX_IN, usesNEAT, isPrey);
-		Agent* agent = new Agent();
-#endif
+	}
 
-		// parse genome
-		genome->readFromFile(genomeFile);
-		genomeFile.close();
+	// set the world's trackers for Genome ID and Gene innovation
+	GenomeCounters& counters = World::current().getGenomeCounters();
+	if(std::any_of(templates.begin(), templates.end(), [](const unique_ptr<Genome>& genome) { return genome == nullptr; }))
+	{
+		// random genomes number their genes the way the files do
+		uint32_t highestRandomInnov = NETWORK_MAX_IN * NETWORK_NUM_OUT - 1;
+		if(counters.highestInnovParsed == UINT32_MAX || highestRandomInnov > counters.highestInnovParsed)
+		{
+			counters.highestInnovParsed = highestRandomInnov;
+		}
+	}
+	Gene::setNextInnovation(counters.highestInnovParsed + 1);
+	Genome::setNextID(counters.highestIDParsed + 1);
 
-		// activate agent
-		mAgents.push_back(agent);
-		agent->setGenome(*genome);
-		agent->activate();
+	// build each species in memory
+	uint32_t numAgents = 0;
+	for(const SpeciesConfig& speciesConfig : species)
+	{
+		numAgents += speciesConfig.count;
 	}
+	mAgents.reserve(numAgents);
+
+	for(size_t i = 0; i < species.size(); ++i)
+	{
+		// a template's own header says which species it is
+		const SpeciesConfig& speciesConfig = species[i];
+		bool isPrey = templates[i] != nullptr ? templates[i]->isPrey() : speciesConfig.isPrey;
+
+		for(uint32_t j = 0; j < speciesConfig.count; ++j)
+		{
+			Agent* agent = createAgent(isPrey);
+			trackAgent(*agent);
+
+			// each agent's genome comes from its own stream
+			Genome* genome = nullptr;
+			{
+				Random::Scope randomScope(agent->getRng());
+				if(templates[i] != nullptr)
+				{
+					genome = new Genome(*templates[i]);
+					genome->mutate(0.0f);
+				}
+				else
+				{
+					genome = createRandomGenome(speciesConfig);
+				}
+			}
 
-	// set static trackers for Genome ID and Gene innovation
-	Gene::setNextInnovation(Genome::sHighestInnovParsed + 1);
-	Genome::setNextID(Genome::sHighestIDParsed + 1);
+			agent->setGenome(*genome);
+			agent->activate();
+		}
+	}
 
 	// select agent
-	mSelectedAgentIndex = 0;
+	mSelectedAgent = mAgents.empty() ? SlotHandle() : mAgents.front()->getHandle();
+
+	scheduleSort();
 }
 
 //-------------------------------------------------------------
 
 void AgentManager::shutdown()
 {
-	// remove existing genome files
-	for(auto& file : directory_iterator(DIR_GENOMES))
+	TimerWheel::cancel(mSortTimer);
+
+	bool savesGenomes = World::current().getConfig().savesGenomes;
+	if(savesGenomes)
 	{
-		std::experimental::filesystem::remove(file.path());
+		// remove existing genome files
+		for(auto& file : directory_iterator(DIR_GENOMES))
+		{
+			std::experimental::filesystem::remove(file.path());
+		}
 	}
 
 	// write genomes to files and delete agents
 	for(Agent* agent : mAgents)
 	{
-		agent->getGenome().writeToFile();
+		if(savesGenomes)
+		{
+			agent->getGenome().writeToFile();
+		}
 		delete agent;
 	}
 	mAgents.clear();
+	for(Agents& speciesAgents : mSpeciesAgents)
+	{
+		speciesAgents.clear();
+	}
+	mNetworkOverlay.clear();
+	mSelectedAgent = SlotHandle();
 }
 
 //-------------------------------------------------------------
 
 void AgentManager::update(const SimClock& clock)
 {
+	TileGrid& tileGrid = World::current().getTileGrid();
+	if(tileGrid.getNumTiles() > 0)
+	{
+		updateTiled(clock, tileGrid);
+		return;
+	}
+
+	// every Agent perceives the world as last tick left it
+	for(uint32_t i = 0; i < Species::COUNT; ++i)
+	{
+		Agent::updatePerception(Species::get(static_cast<Species::ID>(i)), mSpeciesAgents[i]);
+	}
+
+	mThinkStats = ThinkStats();
 	for(Agent* agent : mAgents)
 	{
+		countThink(*agent);
 		agent->update(clock);
 	}
+
+	// contacts are found once everyone has moved, then resolved a pair at a time
+	PhysicalCircle::findContacts(mContacts);
+	Agent::updateCollisions(mContacts);
 }
 
 //-------------------------------------------------------------
 
-void AgentManager::render(Renderer& renderer)
+void AgentManager::updateTiled(const SimClock& clock, TileGrid& tileGrid)
 {
+	// objects that crossed a tile edge last tick change hands before any tile runs
+	tileGrid.migrate(PhysicalCircle::getCollisionObjLists(PhysicalCircle::classTypeID()));
+
+	// every Agent perceives the world as last tick left it, so no tile moves until all have looked
+	tileGrid.forEachTile([](TileGrid::Tile& tile)
+	{
+		for(auto& agents : tile.agents)
+		{
+			agents.clear();
+		}
+
+		for(PhysicalCircle* obj : tile.owned)
+		{
+			if(Agent* agent = obj->as<Agent>())
+			{
+				tile.agents[agent->getSpecies().id].push_back(agent);
+			}
+		}
+
+		for(uint32_t i = 0; i < Species::COUNT; ++i)
+		{
+			Agent::updatePerception(Species::get(static_cast<Species::ID>(i)), tile.agents[i]);
+		}
+	});
+
+	tileGrid.forEachTile([&clock](TileGrid::Tile& tile)
+	{
+		for(auto& agents : tile.agents)
+		{
+			for(Agent* agent : agents)
+			{
+				agent->think(clock);
+			}
+		}
+	});
+
+	// deaths post events, so they're settled here in the same order the serial update uses
+	mThinkStats = ThinkStats();
 	for(Agent* agent : mAgents)
 	{
-		agent->render(renderer);
+		countThink(*agent);
+		if(agent->isAlive() && agent->hasStarved())
+		{
+			agent->kill();
+		}
 	}
 
-	if(mDrawsNetwork)
+	tileGrid.findContacts(mContacts);
+	Agent::updateCollisions(mContacts);
+}
+
+//-------------------------------------------------------------
+
+void AgentManager::render(DrawList& drawList)
+{
+	// only draw what the camera can see
+	const ViewBounds& view = drawList.getView();
+	PhysicalCircle::getSpatialIndex().query(view.min, view.max, mVisibleObjects);
+
+	for(PhysicalCircle* obj : mVisibleObjects)
+	{
+		if(Agent* agent = obj->as<Agent>())
+		{
+			agent->render(drawList);
+		}
+	}
+
+	Agent* selectedAgent = findSelectedAgent();
+	if(mDrawsNetwork && selectedAgent != nullptr)
 	{
-		mAgents[mSelectedAgentIndex]->drawNetwork(renderer);
+		// network overlay sits on top of the world, fixed to the window
+		drawList.beginLayer(DrawList::Space::SCREEN);
+		mNetworkOverlay.render(drawList, selectedAgent->getNetwork());
 	}
 }
 
 //-------------------------------------------------------------
 
+void AgentManager::hashState(EntityHashes& outHashes) const
+{
+	for(size_t i = 0; i < mAgents.size(); ++i)
+	{
+		StateHash hash;
+		mAgents[i]->hashState(hash);
+		outHashes.push_back(EntityHash{ "Agent", 0, static_cast<uint32_t>(i), hash.get() });
+	}
+}
+
+//-------------------------------------------------------------
+
+SlotHandle AgentManager::addAgent(Genome& genome)
+{
+	Agent* agent = createAgent(genome.isPrey());
+	trackAgent(*agent);
+
+	agent->setGenome(genome);
+	agent->activate();
+
+	return agent->getHandle();
+}
+
+//-------------------------------------------------------------
+
+bool AgentManager::removeAgent(SlotHandle handle)
+{
+	PhysicalCircle* obj = PhysicalCircle::find(handle);
+	auto iter = std::find(mAgents.begin(), mAgents.end(), obj);
+	if(obj == nullptr || iter == mAgents.end())
+	{
+		return false;
+	}
+
+	// keep the rest in order, so seeded runs repeat
+	uint32_t index = static_cast<uint32_t>(iter - mAgents.begin());
+	Agents& speciesAgents = mSpeciesAgents[(*iter)->getSpecies().id];
+	speciesAgents.erase(std::find(speciesAgents.begin(), speciesAgents.end(), obj));
+	mAgents.erase(iter);
+
+	// the selection passes to whoever took the agent's place
+	if(mSelectedAgent == handle)
+	{
+		mSelectedAgent = mAgents.empty() ? SlotHandle() : mAgents[std::min(index, getNumAgents() - 1)]->getHandle();
+	}
+
+	// the agent takes its handle with it -- any pending events about it find nothing
+	delete obj;
+	return true;
+}
+
+//-------------------------------------------------------------
+
+uint32_t AgentManager::getNumAgents() const
+{
+	return static_cast<uint32_t>(mAgents.size());
+}
+
+//-------------------------------------------------------------
+
 void AgentManager::selectNextAgent()
 {
-	mAgents[mSelectedAgentIndex]->deselect();
+	Agent* selectedAgent = findSelectedAgent();
+	if(selectedAgent == nullptr)
+	{
+		return;
+	}
+	selectedAgent->deselect();
 
-	++mSelectedAgentIndex;
-	mSelectedAgentIndex %= mAgents.size();
+	size_t index = std::find(mAgents.begin(), mAgents.end(), selectedAgent) - mAgents.begin();
+	selectedAgent = mAgents[(index + 1) % mAgents.size()];
+	mSelectedAgent = selectedAgent->getHandle();
 
 	if(mDrawsNetwork)
 	{
-		mAgents[mSelectedAgentIndex]->select();
+		selectedAgent->select();
 	}
 }
 
@@ -136,17 +339,20 @@ void AgentManager::selectNextAgent()
 
 void AgentManager::selectPrevAgent()
 {
-	mAgents[mSelectedAgentIndex]->deselect();
-
-	--mSelectedAgentIndex;
-	if(mSelectedAgentIndex >= mAgents.size())
+	Agent* selectedAgent = findSelectedAgent();
+	if(selectedAgent == nullptr)
 	{
-		mSelectedAgentIndex = static_cast<uint32_t>(mAgents.size() - 1);
+		return;
 	}
+	selectedAgent->deselect();
+
+	size_t index = std::find(mAgents.begin(), mAgents.end(), selectedAgent) - mAgents.begin();
+	selectedAgent = mAgents[(index + mAgents.size() - 1) % mAgents.size()];
+	mSelectedAgent = selectedAgent->getHandle();
 
 	if(mDrawsNetwork)
 	{
-		mAgents[mSelectedAgentIndex]->select();
+		selectedAgent->select();
 	}
 }
 
@@ -170,14 +376,116 @@ void AgentManager::toggleAllowMutation()
 void AgentManager::toggleDrawNetwork()
 {
 	mDrawsNetwork = !mDrawsNetwork;
+
+	Agent* selectedAgent = findSelectedAgent();
+	if(selectedAgent == nullptr)
+	{
+		return;
+	}
+
 	if(mDrawsNetwork)
 	{
-		mAgents[mSelectedAgentIndex]->select();
+		selectedAgent->select();
 	}
 	else
 	{
-		mAgents[mSelectedAgentIndex]->deselect();
+		selectedAgent->deselect();
+		mNetworkOverlay.clear();
+	}
+}
+
+//-------------------------------------------------------------
+
+void AgentManager::collectElites(uint32_t count, vector<const Agent*>& outAgents) const
+{
+	outAgents.clear();
+
+	for(bool isPrey : { true, false })
+	{
+		size_t first = outAgents.size();
+		for(const Agent* agent : mAgents)
+		{
+			if(agent->isAlive() && agent->getGenome().isPrey() == isPrey)
+			{
+				outAgents.push_back(agent);
+			}
+		}
+
+		// keep only the fittest of this species
+		size_t numElites = std::min(static_cast<size_t>(count), outAgents.size() - first);
+		std::partial_sort(outAgents.begin() + first, outAgents.begin() + first + numElites, outAgents.end(),
+			[](const Agent* lhs, const Agent* rhs) { return lhs->getFitness() > rhs->getFitness(); });
+		outAgents.resize(first + numElites);
+	}
+}
+
+//-------------------------------------------------------------
+
+bool AgentManager::receiveMigrant(istream& stream)
+{
+	Genome* genome = readGenome(stream, false, nullptr);
+	if(genome == nullptr)
+	{
+		return false;
+	}
+
+	// the migrant replaces the weakest living agent of its species
+	Agent* weakestAgent = nullptr;
+	for(Agent* agent : mAgents)
+	{
+		if(agent->isAlive() && agent->getGenome().isPrey() == genome->isPrey() &&
+			(weakestAgent == nullptr || agent->getFitness() < weakestAgent->getFitness()))
+		{
+			weakestAgent = agent;
+		}
+	}
+
+	if(weakestAgent == nullptr)
+	{
+		delete genome;
+		return false;
+	}
+
+	weakestAgent->setGenome(*genome);
+	weakestAgent->activate();
+	return true;
+}
+
+//-------------------------------------------------------------
+
+FitnessSummary AgentManager::getFitnessSummary(bool isPrey) const
+{
+	FitnessSummary summary;
+
+	float totalFitness = 0.0f;
+	for(const Agent* agent : mAgents)
+	{
+		if(agent->isAlive() && agent->getGenome().isPrey() == isPrey)
+		{
+			float fitness = agent->getFitness();
+			if(summary.count == 0 || fitness > summary.best)
+			{
+				summary.best = fitness;
+			}
+
+			totalFitness += fitness;
+			++summary.count;
+		}
+	}
+
+	if(summary.count > 0)
+	{
+		summary.mean = totalFitness / summary.count;
 	}
+
+	return summary;
+}
+
+//-------------------------------------------------------------
+
+const ThinkStats& AgentManager::getThinkStats() const
+{
+	return mThinkStats;
 }
 
 //-------------------------------------------------------------
@@ -186,8 +494,17 @@ void AgentManager::notify(const IPublisher& e)
 {
 	if(Event<AgentDeath>* agentDeath = e.as<Event<AgentDeath>>())
 	{
+		// the agent may have been removed while the event waited
 		const AgentDeath& args = agentDeath->message();
-		Agent* deadAgent = args.agent;
+		PhysicalCircle* obj = PhysicalCircle::find(args.agent);
+		Agent* deadAgent = obj != nullptr ? obj->as<Agent>() : nullptr;
+		if(deadAgent == nullptr)
+		{
+			return;
+		}
+
+		// breed from the dead agent's stream
+		Random::Scope randomScope(deadAgent->getRng());
 
 		// get best active agents to be parents for the replacement
 		Agent* bestAgent = nullptr;
@@ -252,11 +569,14 @@ void AgentManager::notify(const IPublisher& e)
 			newGenome->mutate(deadAgent->getFitness());
 		}
 
+		if(World::current().getConfig().logsFitness)
+		{
 #if USES_PREDATOR_PREY
-		writeFitnessToFile(newGenome->isPrey() ? PREY_FITNESS_FILE : PREDATOR_FITNESS_FILE, deadAgent->getFitness());
+			writeFitnessToFile(newGenome->isPrey() ? PREY_FITNESS_FILE : PREDATOR_FITNESS_FILE, deadAgent->getFitness());
 #else
-		writeFitnessToFile(AGENT_FITNESS_FILE, deadAgent->getFitness());
+			writeFitnessToFile(AGENT_FITNESS_FILE, deadAgent->getFitness());
 #endif
+		}
 
 		// reinit dead agent
 		deadAgent->setGenome(*newGenome);
@@ -266,6 +586,190 @@ void AgentManager::notify(const IPublisher& e)
 
 //-------------------------------------------------------------
 
+void AgentManager::scheduleSort()
+{
+	float sortPeriod = World::current().getConfig().params.agentSortPeriod;
+	if(sortPeriod <= 0.0f)
+	{
+		return;
+	}
+
+	mSortTimer = TimerWheel::schedule(sortPeriod, [this]()
+	{
+		sortAgents();
+		scheduleSort();
+	});
+}
+
+//-------------------------------------------------------------
+
+void AgentManager::sortAgents()
+{
+	const vec2& bounds = World::current().getBounds();
+
+	mSortEntries.clear();
+	for(Agent* agent : mAgents)
+	{
+		uint32_t code = SimMath::mortonCode(vec2(agent->getPosition()), bounds);
+		mSortEntries.push_back(SortEntry{ code, agent->getHandle().index, agent });
+	}
+
+	// handle indices are unique, so every run settles on the same order
+	std::sort(mSortEntries.begin(), mSortEntries.end(), [](const SortEntry& lhs, const SortEntry& rhs)
+	{
+		return lhs.code < rhs.code || (lhs.code == rhs.code && lhs.handleIndex < rhs.handleIndex);
+	});
+
+	for(Agents& speciesAgents : mSpeciesAgents)
+	{
+		speciesAgents.clear();
+	}
+
+	for(size_t i = 0; i < mSortEntries.size(); ++i)
+	{
+		Agent* agent = mSortEntries[i].agent;
+		mAgents[i] = agent;
+		mSpeciesAgents[agent->getSpecies().id].push_back(agent);
+	}
+}
+
+//-------------------------------------------------------------
+
+Agent* AgentManager::findSelectedAgent() const
+{
+	PhysicalCircle* obj = PhysicalCircle::find(mSelectedAgent);
+	return obj != nullptr ? obj->as<Agent>() : nullptr;
+}
+
+//-------------------------------------------------------------
+
+void AgentManager::countThink(const Agent& agent)
+{
+	if(agent.isAlive())
+	{
+		if(agent.isThinking())
+		{
+			++mThinkStats.numThinks;
+		}
+		else
+		{
+			++mThinkStats.numHolds;
+		}
+	}
+}
+
+//-------------------------------------------------------------
+
+void AgentManager::loadGenomeFiles()
+{
+	// directory order is up to the file system -- sort so seeded runs repeat
+	vector<path> genomePaths;
+	for(auto& file : directory_iterator(DIR_GENOMES))
+	{
+		genomePaths.push_back(file.path());
+	}
+	std::sort(genomePaths.begin(), genomePaths.end());
+
+	// for each genome ini file...
+	for(const path& genomePath : genomePaths)
+	{
+		// parse genome, creating an agent of the appropriate type
+		ifstream genomeFile;
+		genomeFile.open(genomePath.c_str(), ifstream::in);
+
+		Agent* agent = nullptr;
+		Genome* genome = readGenome(genomeFile, true, &agent);
+		genomeFile.close();
+
+		if(genome == nullptr)
+		{
+			continue;
+		}
+
+		// activate agent with its own random stream
+		trackAgent(*agent);
+		agent->setGenome(*genome);
+		agent->activate();
+	}
+}
+
+//-------------------------------------------------------------
+
+void AgentManager::trackAgent(Agent& agent)
+{
+	// streams are numbered by creation, so removals never hand one out twice
+	agent.setRng(World::current().getRng().split(mNumAgentsCreated));
+	++mNumAgentsCreated;
+
+	mAgents.push_back(&agent);
+	mSpeciesAgents[agent.getSpecies().id].push_back(&agent);
+}
+
+//-------------------------------------------------------------
+
+Genome* AgentManager::readGenome(istream& stream, bool keepsID, Agent** outAgent)
+{
+	// read genome header information
+	uint32_t id; bool usesNEAT, isPrey;
+	if(!(stream >> id >> usesNEAT >> isPrey))
+	{
+		return nullptr;
+	}
+
+	if(!keepsID)
+	{
+		id = Genome::nextID();
+	}
+
+	// create genome and agent of the appropriate type
+	Genome* genome = new Genome(id, getNumInputs(isPrey), usesNEAT, isPrey);
+	if(outAgent != nullptr)
+	{
+		*outAgent = createAgent(isPrey);
+	}
+
+	// parse genome
+	genome->readFromStream(stream);
+	return genome;
+}
+
+//-------------------------------------------------------------
+
+Genome* AgentManager::createRandomGenome(const SpeciesConfig& species)
+{
+	uint32_t numInputs = getNumInputs(species.isPrey);
+	Genome* genome = new Genome(Genome::nextID(), numInputs, USES_NEAT != 0, species.isPrey);
+	genome->mSizeGene = species.sizeGene;
+
+	// every sensor feeds every output, numbered as in the genome files
+	for(uint32_t sensor = 0; sensor < numInputs; ++sensor)
+	{
+		for(uint32_t output = 0; output < NETWORK_NUM_OUT; ++output)
+		{
+			float weight = Random::randomRange(-species.weightRange, species.weightRange);
+			genome->addGene(sensor * NETWORK_NUM_OUT + output, sensor, NETWORK_MAX_NODES + output, weight, false);
+		}
+	}
+
+	return genome;
+}
+
+//-------------------------------------------------------------
+
+uint32_t AgentManager::getNumInputs(bool isPrey)
+{
+	return Species::forGenome(isPrey).numInputs;
+}
+
+//-------------------------------------------------------------
+
+Agent* AgentManager::createAgent(bool isPrey)
+{
+	return Species::forGenome(isPrey).create();
+}
+
+//-------------------------------------------------------------
+
 void AgentManager::writeFitnessToFile(const string& filename, float fitness) const
 {
 	ofstream fitnessFile;
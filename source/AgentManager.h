@@ -3,9 +3,37 @@
 
 #include "ISubscriber.h"
 #include "Agent.h"
+#include "NetworkOverlay.h"
 
 namespace Ecosim
 {
+	struct SpeciesConfig;
+	class TileGrid;
+
+	/**	Summary of the fitness of one species'
+	 *	living Agents.
+	 */
+	struct FitnessSummary
+	{
+		float best = 0.0f;
+		float mean = 0.0f;
+		std::uint32_t count = 0;
+	};
+
+	//=============================================================
+
+	/**	How many living Agents ran their networks in
+	 *	one tick, and how many held their last outputs
+	 *	instead.
+	 */
+	struct ThinkStats
+	{
+		std::uint32_t numThinks = 0;
+		std::uint32_t numHolds = 0;
+	};
+
+	//=============================================================
+
 	/**	Simulation component that manages a list
 	 *	of Agents.
 	 */
@@ -26,33 +54,75 @@ namespace Ecosim
 		 */
 		~AgentManager();
 
-		/**	@brief Initializes a list of Agents using
-		 *		   Genome files. Uses a pch macro to
-		 *		   determine if it creates Predators
-		 *		   and Prey, or normal Agents.
+		/**	@brief Initializes a list of Agents. If the
+		 *		   World's config lists species, their
+		 *		   Agents are built in memory. Otherwise
+		 *		   there is one Agent per Genome file.
+		 *		   Uses a pch macro to determine if it
+		 *		   creates Predators and Prey, or normal
+		 *		   Agents.
 		 */
 		virtual void init() override;
 
-		/**	@brief Deletes all Agents.
+		/**	@brief Deletes all Agents and stops re-sorting
+		 *		   them.
 		 */
 		virtual void shutdown() override;
 
-		/**	@brief Updates all living Agents.
+		/**	@brief Updates all living Agents, tile by tile
+		 *		   if the World is tiled.
 		 *
 		 *	@param clock The simulation's timekeeper.
 		 */
 		virtual void update(const SimClock& clock) override;
 
-		/**	@brief Renders all living Agents. Also
-		 *		   renders the NeuralNetwork of the
-		 *		   currently selected Agent if flagged
-		 *		   to do so.
+		/**	@brief Renders the living Agents the camera
+		 *		   can see. Also renders the NeuralNetwork
+		 *		   of the currently selected Agent if
+		 *		   flagged to do so.
+		 *
+		 *	@param drawList The frame being drawn.
+		 */
+		virtual void render(DrawList& drawList) override;
+
+		/**	@brief Hashes the state of each Agent, in list
+		 *		   order.
+		 *
+		 *	@param outHashes Receives the hashes. Appended to.
+		 */
+		virtual void hashState(EntityHashes& outHashes) const override;
+
+		/**	@brief Creates a new Agent and activates it with
+		 *		   a Genome. The population grows by one.
+		 *
+		 *	@param genome The Genome. The Agent takes
+		 *				  possession of it.
+		 *
+		 *	@return Returns the Agent's object handle.
+		 */
+		SlotHandle addAgent(Genome& genome);
+
+		/**	@brief Deletes an Agent. The population shrinks
+		 *		   by one. Must not be called while Agents
+		 *		   are updating -- event handlers are fine.
+		 *
+		 *	@param handle The Agent's object handle.
+		 *
+		 *	@return Returns false if the handle is stale or
+		 *			isn't one of our Agents.
+		 */
+		bool removeAgent(SlotHandle handle);
+
+		/**	@brief Gets the size of the population, living
+		 *		   and dead.
 		 *
-		 *	@param renderer The simulation rendering object.
+		 *	@return Returns the size of mAgents.
 		 */
-		virtual void render(Renderer& renderer) override;
+		std::uint32_t getNumAgents() const;
 
-		/**	@brief Selects the next Agent in the list.
+		/**	@brief Selects the next Agent in the list. The
+		 *		   list is re-sorted now and then, so the
+		 *		   order is by place in the world.
 		 */
 		void selectNextAgent();
 
@@ -70,6 +140,42 @@ namespace Ecosim
 		 */
 		void toggleDrawNetwork();
 
+		/**	@brief Gets the fittest living Agents of each
+		 *		   species, fittest first.
+		 *
+		 *	@param count The most Agents to take per species.
+		 *	@param outAgents Receives the Agents. Cleared first.
+		 */
+		void collectElites(std::uint32_t count, std::vector<const Agent*>& outAgents) const;
+
+		/**	@brief Parses a serialized Genome from another
+		 *		   World and gives it to the least fit living
+		 *		   Agent of the same species. The Genome is
+		 *		   given a new ID from this World.
+		 *
+		 *	@param stream The stream holding the Genome, as
+		 *				  written by Genome::writeToStream.
+		 *
+		 *	@return Returns true if an Agent took the Genome.
+		 */
+		bool receiveMigrant(std::istream& stream);
+
+		/**	@brief Summarizes the fitness of one species'
+		 *		   living Agents.
+		 *
+		 *	@param isPrey Says which species to summarize.
+		 *
+		 *	@return Returns the summary.
+		 */
+		FitnessSummary getFitnessSummary(bool isPrey) const;
+
+		/**	@brief Gets how much thinking the last tick took,
+		 *		   and how much it saved.
+		 *
+		 *	@return Returns mThinkStats.
+		 */
+		const ThinkStats& getThinkStats() const;
+
 		/**	@brief Receives signals of Agent death, and
 		 *		   breeds a new Genome for the dead Agent.
 		 *
@@ -79,6 +185,98 @@ namespace Ecosim
 
 	private:
 
+		/**	@brief Updates the Agents tile by tile, each tile
+		 *		   on its own worker. Gives the same results
+		 *		   as the serial update.
+		 *
+		 *	@param clock The simulation's timekeeper.
+		 *	@param tileGrid The World's tiles.
+		 */
+		void updateTiled(const SimClock& clock, TileGrid& tileGrid);
+
+		/**	@brief Re-sorts the Agents once the World's
+		 *		   sort period has passed, then reschedules
+		 *		   itself. Does nothing if the period is 0.
+		 */
+		void scheduleSort();
+
+		/**	@brief Sorts the Agents, and each species' list,
+		 *		   by where they stand along a Z-order curve,
+		 *		   so Agents updated one after another read
+		 *		   the same parts of the world's grids.
+		 *		   Handles are untouched, so the selection
+		 *		   and pending events still find their Agents.
+		 */
+		void sortAgents();
+
+		/**	@brief Finds the selected Agent.
+		 *
+		 *	@return Returns the Agent, or nullptr if there
+		 *			are no Agents.
+		 */
+		Agent* findSelectedAgent() const;
+
+		/**	@brief Counts a living Agent toward this tick's
+		 *		   think stats.
+		 *
+		 *	@param agent The Agent, after perception.
+		 */
+		void countThink(const Agent& agent);
+
+		/**	@brief Creates one Agent for each Genome file.
+		 */
+		void loadGenomeFiles();
+
+		/**	@brief Gives a new Agent the next random stream
+		 *		   and adds it to the list.
+		 *
+		 *	@param agent The new Agent.
+		 */
+		void trackAgent(Agent& agent);
+
+		/**	@brief Parses a serialized Genome and creates an
+		 *		   Agent of the matching type for it.
+		 *
+		 *	@param stream The stream holding the Genome.
+		 *	@param keepsID Says whether the Genome keeps the
+		 *				   ID it was written with, or takes
+		 *				   a new one.
+		 *	@param outAgent Receives a new Agent of the Genome's
+		 *					type, or nullptr if not wanted.
+		 *
+		 *	@return Returns the new Genome, or nullptr if the
+		 *			stream held no Genome.
+		 */
+		static Genome* readGenome(std::istream& stream, bool keepsID, Agent** outAgent);
+
+		/**	@brief Creates a Genome that connects every
+		 *		   sensor to every output with random weights.
+		 *		   Draws from the bound random stream.
+		 *
+		 *	@param species The species the Genome is for.
+		 *
+		 *	@return Returns the new Genome.
+		 */
+		static Genome* createRandomGenome(const SpeciesConfig& species);
+
+		/**	@brief Gets the number of sensors a species'
+		 *		   Genomes have.
+		 *
+		 *	@param isPrey Says which species.
+		 *
+		 *	@return Returns the number of sensors.
+		 */
+		static std::uint32_t getNumInputs(bool isPrey);
+
+		/**	@brief Creates an Agent of the type that carries
+		 *		   a species' Genomes.
+		 *
+		 *	@param isPrey Says which species the Agent is.
+		 *
+		 *	@return Returns the new Agent.
+		 */
+		static Agent* createAgent(bool isPrey);
+
 		/**	@brief Writes the fitness of a dead Agent out
 		 *		   to a file.
 		 *
@@ -91,7 +289,31 @@ namespace Ecosim
 		typedef std::vector<Agent*> Agents;
 		Agents mAgents;
 
-		uint32_t mSelectedAgentIndex;
+		// the same Agents grouped by species, in the same order
+		Agents mSpeciesAgents[Species::COUNT];
+
+		// kept between ticks so its storage is reused
+		std::vector<Contact> mContacts;
+
+		// one Agent's place along the curve -- handle index breaks ties
+		struct SortEntry
+		{
+			std::uint32_t code;
+			std::uint32_t handleIndex;
+			Agent* agent;
+		};
+
+		std::vector<SortEntry> mSortEntries;
+		TimerHandle mSortTimer;
+
+		ThinkStats mThinkStats;
+
+		std::vector<PhysicalCircle*> mVisibleObjects;
+		NetworkOverlay mNetworkOverlay;
+
+		// held by handle, since the list order changes under it
+		SlotHandle mSelectedAgent;
+		std::uint32_t mNumAgentsCreated;
 
 		bool mAllowsMutation;
 		bool mDrawsNetwork;
@@ -0,0 +1,80 @@
+#include "pch.h"
+#include "Camera.h"
+
+using namespace Ecosim;
+using namespace std;
+using namespace glm;
+
+const float ZOOM_STEP = 1.25f;
+const float MAX_ZOOM = 8.0f;
+
+Camera::Camera() :
+	mViewportSize(1.0f, 1.0f),
+	mWorldSize(1.0f, 1.0f),
+	mCenter(0.5f, 0.5f),
+	mZoom(1.0f),
+	mMinZoom(1.0f)
+{
+}
+
+//-------------------------------------------------------------
+
+void Camera::init(const vec2& viewportSize, const vec2& worldSize)
+{
+	mViewportSize = viewportSize;
+	mWorldSize = worldSize;
+
+	// never zoom out further than twice the span that fits the world
+	mMinZoom = std::min(mViewportSize.x / mWorldSize.x, mViewportSize.y / mWorldSize.y) * 0.5f;
+
+	reset();
+}
+
+//-------------------------------------------------------------
+
+void Camera::reset()
+{
+	mCenter = mWorldSize * 0.5f;
+	mZoom = std::min(mViewportSize.x / mWorldSize.x, mViewportSize.y / mWorldSize.y);
+}
+
+//-------------------------------------------------------------
+
+void Camera::pan(const vec2& direction)
+{
+	mCenter += direction * (mViewportSize / mZoom);
+	clampToWorld();
+}
+
+//-------------------------------------------------------------
+
+void Camera::zoomIn()
+{
+	mZoom *= ZOOM_STEP;
+	clampToWorld();
+}
+
+//-------------------------------------------------------------
+
+void Camera::zoomOut()
+{
+	mZoom /= ZOOM_STEP;
+	clampToWorld();
+}
+
+//-------------------------------------------------------------
+
+ViewBounds Camera::getView() const
+{
+	vec2 halfExtents = mViewportSize * (0.5f / mZoom);
+	return ViewBounds{ mCenter - halfExtents, mCenter + halfExtents, mZoom };
+}
+
+//-------------------------------------------------------------
+
+void Camera::clampToWorld()
+{
+	mZoom = SimMath::clampNum(mZoom, mMinZoom, MAX_ZOOM);
+	mCenter.x = SimMath::clampNum(mCenter.x, 0.0f, mWorldSize.x);
+	mCenter.y = SimMath::clampNum(mCenter.y, 0.0f, mWorldSize.y);
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "DrawList.h"
+
+namespace Ecosim
+{
+	/**	Pannable, zoomable view onto the world.
+	 *
+	 *	The camera maps a rectangle of the world onto
+	 *	the window. Its zoom is measured in window
+	 *	pixels per world unit, and it starts out fitting
+	 *	the whole world in the window.
+	 */
+	class Camera final
+	{
+	public:
+
+		Camera(const Camera& other) = delete;
+		Camera& operator=(const Camera& other) = delete;
+		Camera(Camera&& other) = delete;
+		Camera& operator=(Camera&& other) = delete;
+
+		/**	@brief Constructor.
+		 */
+		Camera();
+
+		/**	@brief Destructor.
+		 */
+		~Camera() = default;
+
+		/**	@brief Sets the window and world sizes, then
+		 *		   fits the whole world in the window.
+		 *
+		 *	@param viewportSize The window size, in pixels.
+		 *	@param worldSize The world size, in world units.
+		 */
+		void init(const glm::vec2& viewportSize, const glm::vec2& worldSize);
+
+		/**	@brief Fits the whole world in the window.
+		 */
+		void reset();
+
+		/**	@brief Moves the camera by a fraction of the
+		 *		   visible area.
+		 *
+		 *	@param direction The xy distance to move, in view widths
+		 *					 and heights.
+		 */
+		void pan(const glm::vec2& direction);
+
+		/**	@brief Zooms in one step, keeping the center fixed.
+		 */
+		void zoomIn();
+
+		/**	@brief Zooms out one step, keeping the center fixed.
+		 */
+		void zoomOut();
+
+		/**	@brief Gets the part of the world the camera
+		 *		   currently sees.
+		 *
+		 *	@return Returns the visible world rectangle.
+		 */
+		ViewBounds getView() const;
+
+	private:
+
+		/**	@brief Keeps the zoom within limits and the
+		 *		   center within the world.
+		 */
+		void clampToWorld();
+
+
+		glm::vec2 mViewportSize;
+		glm::vec2 mWorldSize;
+		glm::vec2 mCenter;
+
+		float mZoom;
+		float mMinZoom;
+	};
+}
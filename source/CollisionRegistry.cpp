@@ -0,0 +1,89 @@
+#include "pch.h"
+#include "CollisionRegistry.h"
+
+#include "PhysicalCircle.h"
+
+using namespace Ecosim;
+using namespace std;
+
+void CollisionRegistry::add(PhysicalCircle& obj)
+{
+	uint32_t ordinal = getOrdinal(obj);
+	if(ordinal == obj.mRegistryType)
+	{
+		return;
+	}
+
+	remove(obj);
+
+	Members& members = mMembers[ordinal];
+	obj.mRegistryType = ordinal;
+	obj.mRegistryIndex = static_cast<uint32_t>(members.size());
+	members.push_back(&obj);
+	++mSize;
+}
+
+//-------------------------------------------------------------
+
+void CollisionRegistry::remove(PhysicalCircle& obj)
+{
+	if(obj.mRegistryType == NO_TYPE)
+	{
+		return;
+	}
+
+	Members& members = mMembers[obj.mRegistryType];
+	assert(obj.mRegistryIndex < members.size() && members[obj.mRegistryIndex] == &obj);
+
+	// fill the hole with the last member
+	PhysicalCircle* last = members.back();
+	members[obj.mRegistryIndex] = last;
+	last->mRegistryIndex = obj.mRegistryIndex;
+	members.pop_back();
+
+	obj.mRegistryType = NO_TYPE;
+	obj.mRegistryIndex = 0;
+	--mSize;
+}
+
+//-------------------------------------------------------------
+
+const CollisionRegistry::Lists& CollisionRegistry::getLists(uint64_t typeID) const
+{
+	static const Lists sEmpty;
+
+	auto iter = mQueryLists.find(typeID);
+	return iter != mQueryLists.end() ? iter->second : sEmpty;
+}
+
+//-------------------------------------------------------------
+
+uint32_t CollisionRegistry::size() const
+{
+	return mSize;
+}
+
+//-------------------------------------------------------------
+
+uint32_t CollisionRegistry::getOrdinal(const PhysicalCircle& obj)
+{
+	auto iter = mOrdinals.find(obj.instanceTypeID());
+	if(iter != mOrdinals.end())
+	{
+		return iter->second;
+	}
+
+	// new exact type -- its list answers queries for it and everything above it
+	uint32_t ordinal = static_cast<uint32_t>(mMembers.size());
+	mMembers.emplace_back();
+	mOrdinals.emplace(obj.instanceTypeID(), ordinal);
+
+	mChainScratch.clear();
+	obj.appendTypeIDs(mChainScratch);
+	for(uint64_t typeID : mChainScratch)
+	{
+		mQueryLists[typeID].push_back(&mMembers.back());
+	}
+
+	return ordinal;
+}
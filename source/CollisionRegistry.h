@@ -0,0 +1,103 @@
+#pragma once
+
+namespace Ecosim
+{
+	class PhysicalCircle;
+
+	/**	Membership lists of every PhysicalCircle in
+	 *	a World, kept by type.
+	 *
+	 *	Each object sits in exactly one dense list:
+	 *	the one for its most derived type. Removal
+	 *	swaps the last member into the hole, so it
+	 *	never searches. A query for a type answers
+	 *	with every list whose type is, or derives
+	 *	from, that type. Those answers are worked out
+	 *	once, the first time an exact type is seen,
+	 *	so a query is a single table lookup.
+	 *
+	 *	Constructors register as they run, so an
+	 *	object is moved down its inheritance chain
+	 *	until it settles in its final type's list.
+	 *	Order within a list changes as members are
+	 *	removed.
+	 */
+	class CollisionRegistry final
+	{
+	public:
+
+		typedef std::vector<PhysicalCircle*> Members;
+		typedef std::vector<const Members*> Lists;
+
+		CollisionRegistry(const CollisionRegistry& other) = delete;
+		CollisionRegistry& operator=(const CollisionRegistry& other) = delete;
+		CollisionRegistry(CollisionRegistry&& other) = delete;
+		CollisionRegistry& operator=(CollisionRegistry&& other) = delete;
+
+		/**	@brief Constructor.
+		 */
+		CollisionRegistry() = default;
+
+		/**	@brief Destructor.
+		 */
+		~CollisionRegistry() = default;
+
+		/**	@brief Files an object under its current type.
+		 *		   An object that is already registered is
+		 *		   moved out of its old list.
+		 *
+		 *	@param obj The object.
+		 */
+		void add(PhysicalCircle& obj);
+
+		/**	@brief Takes an object out of its list. Does
+		 *		   nothing if it is not registered.
+		 *
+		 *	@param obj The object.
+		 */
+		void remove(PhysicalCircle& obj);
+
+		/**	@brief Gets the lists of every object that is,
+		 *		   or derives from, a type.
+		 *
+		 *	@param typeID The type ID to query.
+		 *
+		 *	@return Returns the lists, or an empty set if
+		 *			no object of the type has been seen.
+		 *			The reference stays valid, but a newly
+		 *			seen type can grow the set.
+		 */
+		const Lists& getLists(std::uint64_t typeID) const;
+
+		/**	@brief Gets the number of registered objects.
+		 *
+		 *	@return Returns the count over every list.
+		 */
+		std::uint32_t size() const;
+
+	private:
+
+		static const std::uint32_t NO_TYPE = UINT32_MAX;
+
+		/**	@brief Gets the list for an exact type,
+		 *		   setting it up the first time.
+		 *
+		 *	@param obj An object of the type, used to
+		 *			   walk its inheritance chain.
+		 *
+		 *	@return Returns the ordinal of the list.
+		 */
+		std::uint32_t getOrdinal(const PhysicalCircle& obj);
+
+
+		// one list per exact type -- a deque so query tables can point at them
+		std::deque<Members> mMembers;
+		std::unordered_map<std::uint64_t, std::uint32_t> mOrdinals;
+
+		// every list that answers a query for each type ID
+		std::unordered_map<std::uint64_t, Lists> mQueryLists;
+
+		std::vector<std::uint64_t> mChainScratch;
+		std::uint32_t mSize = 0;
+	};
+}
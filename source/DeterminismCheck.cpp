@@ -0,0 +1,104 @@
+#include "pch.h"
+#include "DeterminismCheck.h"
+
+#include <cstring>
+
+using namespace Ecosim;
+using namespace std;
+using namespace glm;
+
+// most differing objects listed when the worlds diverge
+const uint32_t MAX_REPORTED_ENTITIES = 10;
+
+void DeterminismCheck::init(const WorldConfig& first, const WorldConfig& second)
+{
+	WorldConfig firstConfig = first;
+	WorldConfig secondConfig = second;
+
+	for(WorldConfig* config : { &firstConfig, &secondConfig })
+	{
+		config->hashesState = true;
+		config->savesGenomes = false;
+		config->logsFitness = false;
+	}
+
+	mFirstWorld.init(firstConfig);
+	mSecondWorld.init(secondConfig);
+}
+
+//-------------------------------------------------------------
+
+int32_t DeterminismCheck::run(uint64_t numTicks, float timeStep)
+{
+	int32_t result = 0;
+
+	for(uint64_t tick = 1; tick <= numTicks; ++tick)
+	{
+		mFirstClock.step(timeStep);
+		mFirstWorld.update(mFirstClock);
+
+		mSecondClock.step(timeStep);
+		mSecondWorld.update(mSecondClock);
+
+		if(mFirstWorld.getStateHash() != mSecondWorld.getStateHash())
+		{
+			reportDivergence(tick);
+			result = 1;
+			break;
+		}
+	}
+
+	if(result == 0)
+	{
+		cout << "Verify -- identical through " << numTicks << " ticks, hash " <<
+			hex << mFirstWorld.getStateHash() << dec << endl;
+	}
+
+	mFirstWorld.shutdown();
+	mSecondWorld.shutdown();
+
+	return result;
+}
+
+//-------------------------------------------------------------
+
+void DeterminismCheck::reportDivergence(uint64_t tick)
+{
+	cout << "Verify -- diverged at tick " << tick << " (" << mFirstClock.getTotalTime() << "s)" << endl;
+
+	mFirstWorld.collectEntityHashes(mFirstHashes);
+	mSecondWorld.collectEntityHashes(mSecondHashes);
+
+	// objects are listed in a fixed order, so walk both lists together
+	uint32_t numReported = 0;
+	size_t numShared = std::min(mFirstHashes.size(), mSecondHashes.size());
+	for(size_t i = 0; i < numShared && numReported < MAX_REPORTED_ENTITIES; ++i)
+	{
+		const EntityHash& first = mFirstHashes[i];
+		const EntityHash& second = mSecondHashes[i];
+
+		bool isSameEntity = strcmp(first.kind, second.kind) == 0 &&
+			first.group == second.group && first.index == second.index;
+
+		if(!isSameEntity || first.hash != second.hash)
+		{
+			cout << "  " << first.kind << " " << first.group << ":" << first.index;
+			if(!isSameEntity)
+			{
+				cout << " vs " << second.kind << " " << second.group << ":" << second.index;
+			}
+			cout << " changed" << endl;
+
+			++numReported;
+		}
+	}
+
+	if(mFirstHashes.size() != mSecondHashes.size())
+	{
+		cout << "  object count " << mFirstHashes.size() << " vs " << mSecondHashes.size() << endl;
+	}
+	else if(numReported == 0)
+	{
+		cout << "  no object differs -- simulation time or a past tick diverged" << endl;
+	}
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "World.h"
+
+namespace Ecosim
+{
+	/**	Runs two Worlds side by side, tick for tick, and
+	 *	checks that their states stay identical.
+	 *
+	 *	Both Worlds keep a rolling hash of their state. As
+	 *	long as the hashes agree after each tick, the runs
+	 *	are bit for bit the same. At the first tick they
+	 *	disagree, the per-object hashes are compared to
+	 *	find which objects differ.
+	 *
+	 *	Use it to prove that two ways of running the same
+	 *	World -- a serial and a parallel tick, say, or a
+	 *	scalar and a vectorized kernel -- give the same
+	 *	results. Configs that share a seed and settings
+	 *	should never diverge.
+	 */
+	class DeterminismCheck final
+	{
+	public:
+
+		DeterminismCheck(const DeterminismCheck& other) = delete;
+		DeterminismCheck& operator=(const DeterminismCheck& other) = delete;
+		DeterminismCheck(DeterminismCheck&& other) = delete;
+		DeterminismCheck& operator=(DeterminismCheck&& other) = delete;
+
+		/**	@brief Constructor.
+		 */
+		DeterminismCheck() = default;
+
+		/**	@brief Destructor.
+		 */
+		~DeterminismCheck() = default;
+
+		/**	@brief Initializes both Worlds. State hashing is
+		 *		   turned on, and genome saving and fitness
+		 *		   logging are turned off, for both.
+		 *
+		 *	@param first The config of the first World.
+		 *	@param second The config of the second World.
+		 */
+		void init(const WorldConfig& first, const WorldConfig& second);
+
+		/**	@brief Ticks both Worlds until their states
+		 *		   diverge or the tick count runs out, then
+		 *		   shuts them down.
+		 *
+		 *	@param numTicks The most ticks to run.
+		 *	@param timeStep Simulated seconds per tick.
+		 *
+		 *	@return Returns 0 if the Worlds never diverged.
+		 *			Returns 1 if they did.
+		 */
+		std::int32_t run(std::uint64_t numTicks, float timeStep);
+
+	private:
+
+		/**	@brief Prints the tick at which the Worlds diverged
+		 *		   and the objects whose state differs.
+		 *
+		 *	@param tick The tick that was just run.
+		 */
+		void reportDivergence(std::uint64_t tick);
+
+
+		World mFirstWorld;
+		World mSecondWorld;
+
+		SimClock mFirstClock;
+		SimClock mSecondClock;
+
+		EntityHashes mFirstHashes;
+		EntityHashes mSecondHashes;
+	};
+}
@@ -0,0 +1,139 @@
+#include "pch.h"
+#include "DrawList.h"
+
+using namespace Ecosim;
+using namespace std;
+using namespace glm;
+
+// the renderer uploads these structs directly -- they must stay tightly packed floats
+static_assert(sizeof(CircleInstance) == 6 * sizeof(float), "CircleInstance must be 6 packed floats");
+static_assert(sizeof(ColoredVertex) == 5 * sizeof(float), "ColoredVertex must be 5 packed floats");
+
+DrawList::DrawList() :
+	mView{ vec2(0.0f, 0.0f), vec2(0.0f, 0.0f), 1.0f }
+{
+	clear();
+}
+
+//-------------------------------------------------------------
+
+void DrawList::drawColoredQuad(const vec3& origin, const vec2& size, const vec3& color)
+{
+	vec2 topLeft(origin);
+	vec2 topRight(origin.x + size.x, origin.y);
+	vec2 bottomRight(origin.x + size.x, origin.y + size.y);
+	vec2 bottomLeft(origin.x, origin.y + size.y);
+
+	mTriangleVertices.push_back(ColoredVertex{ topLeft, color });
+	mTriangleVertices.push_back(ColoredVertex{ topRight, color });
+	mTriangleVertices.push_back(ColoredVertex{ bottomRight, color });
+
+	mTriangleVertices.push_back(ColoredVertex{ topLeft, color });
+	mTriangleVertices.push_back(ColoredVertex{ bottomRight, color });
+	mTriangleVertices.push_back(ColoredVertex{ bottomLeft, color });
+}
+
+//-------------------------------------------------------------
+
+void DrawList::drawColoredCircle(const vec3& origin, float radius, const vec3& color)
+{
+	mCircles.push_back(CircleInstance{ vec2(origin), radius, color });
+}
+
+//-------------------------------------------------------------
+
+void DrawList::drawRay(const vec3& origin, const vec3& direction, float length, const vec3& color)
+{
+	drawLine(origin, origin + direction * length, color);
+}
+
+//-------------------------------------------------------------
+
+void DrawList::drawLine(const vec3& point_1, const vec3& point_2, const vec3& color)
+{
+	mLineVertices.push_back(ColoredVertex{ vec2(point_1), color });
+	mLineVertices.push_back(ColoredVertex{ vec2(point_2), color });
+}
+
+//-------------------------------------------------------------
+
+void DrawList::drawLines(const vector<ColoredVertex>& vertices)
+{
+	assert(vertices.size() % 2 == 0);
+	mLineVertices.insert(mLineVertices.end(), vertices.begin(), vertices.end());
+}
+
+//-------------------------------------------------------------
+
+void DrawList::beginLayer(Space space)
+{
+	mLayers.push_back(Layer
+	{
+		space,
+		static_cast<uint32_t>(mCircles.size()),
+		static_cast<uint32_t>(mLineVertices.size()),
+		static_cast<uint32_t>(mTriangleVertices.size())
+	});
+}
+
+//-------------------------------------------------------------
+
+void DrawList::clear()
+{
+	mLayers.clear();
+	mCircles.clear();
+	mLineVertices.clear();
+	mTriangleVertices.clear();
+
+	// everything starts out in the bottom layer
+	mLayers.push_back(Layer{ Space::WORLD, 0, 0, 0 });
+}
+
+//-------------------------------------------------------------
+
+void DrawList::setView(const ViewBounds& view)
+{
+	mView = view;
+}
+
+//-------------------------------------------------------------
+
+const ViewBounds& DrawList::getView() const
+{
+	return mView;
+}
+
+//-------------------------------------------------------------
+
+bool DrawList::isEmpty() const
+{
+	return mCircles.empty() && mLineVertices.empty() && mTriangleVertices.empty();
+}
+
+//-------------------------------------------------------------
+
+const vector<DrawList::Layer>& DrawList::getLayers() const
+{
+	return mLayers;
+}
+
+//-------------------------------------------------------------
+
+const vector<CircleInstance>& DrawList::getCircles() const
+{
+	return mCircles;
+}
+
+//-------------------------------------------------------------
+
+const vector<ColoredVertex>& DrawList::getLineVertices() const
+{
+	return mLineVertices;
+}
+
+//-------------------------------------------------------------
+
+const vector<ColoredVertex>& DrawList::getTriangleVertices() const
+{
+	return mTriangleVertices;
+}
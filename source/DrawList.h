@@ -0,0 +1,203 @@
+#pragma once
+
+namespace Ecosim
+{
+	/**	One circle in a DrawList. Laid out to be
+	 *	uploaded as-is as per-instance vertex data.
+	 */
+	struct CircleInstance
+	{
+		glm::vec2 center;
+		float radius;
+		glm::vec3 color;
+	};
+
+	//=============================================================
+
+	/**	One vertex of a line or triangle in a
+	 *	DrawList. Laid out to be uploaded as-is
+	 *	as interleaved vertex data.
+	 */
+	struct ColoredVertex
+	{
+		glm::vec2 position;
+		glm::vec3 color;
+	};
+
+	//=============================================================
+
+	/**	The part of the world a frame looks at.
+	 */
+	struct ViewBounds
+	{
+		glm::vec2 min;
+		glm::vec2 max;
+		float pixelsPerUnit;
+	};
+
+	//=============================================================
+
+	/**	CPU-side buffers of the primitives drawn in
+	 *	a frame, grouped by primitive type.
+	 *
+	 *	Drawing appends to these buffers instead of
+	 *	talking to OpenGL, so the Renderer can submit
+	 *	each buffer with a single draw call. Buffers
+	 *	keep their capacity between frames.
+	 *
+	 *	Since a DrawList holds no OpenGL state, it also
+	 *	serves as the snapshot the simulation hands to
+	 *	the render thread. It carries the camera's view
+	 *	so drawing can skip what is off screen.
+	 */
+	class DrawList final
+	{
+	public:
+
+		/**	Coordinate space of a layer. World layers
+		 *	follow the camera. Screen layers are in
+		 *	window pixels.
+		 */
+		enum class Space
+		{
+			WORLD,
+			SCREEN
+		};
+
+		/**	Where one layer starts in each buffer.
+		 *	A layer ends where the next one starts.
+		 */
+		struct Layer
+		{
+			Space space;
+			std::uint32_t firstCircle;
+			std::uint32_t firstLineVertex;
+			std::uint32_t firstTriangleVertex;
+		};
+
+		DrawList(const DrawList& other) = delete;
+		DrawList& operator=(const DrawList& other) = delete;
+		DrawList(DrawList&& other) = delete;
+		DrawList& operator=(DrawList&& other) = delete;
+
+		/**	@brief Constructor.
+		 */
+		DrawList();
+
+		/**	@brief Destructor.
+		 */
+		~DrawList() = default;
+
+		/**	@brief Draws a solid-color quad as two triangles.
+		 *
+		 *	@param origin The xyz of the top-left corner of the quad.
+		 *	@param size The x and y dimensions of the quad.
+		 *	@param color The rgb color of the quad.
+		 */
+		void drawColoredQuad(const glm::vec3& origin, const glm::vec2& size, const glm::vec3& color);
+
+		/**	@brief Draws a solid-color circle.
+		 *
+		 *	@param origin The xyz of the center of the circle.
+		 *	@param radius The radius of the circle.
+		 *	@param color The rgb color of the circle.
+		 */
+		void drawColoredCircle(const glm::vec3& origin, float radius, const glm::vec3& color);
+
+		/**	@brief Draws a line in a direction from a point.
+		 *
+		 *	@param origin The xyz of the start of the line.
+		 *	@param direction The xyz direction of the line.
+		 *	@param length The length of the line.
+		 *	@param color The rgb color of the line.
+		 */
+		void drawRay(const glm::vec3& origin, const glm::vec3& direction, float length, const glm::vec3& color);
+
+		/**	@brief Draws a line between two points.
+		 *
+		 *	@param point_1 The xyz of the first point of the line.
+		 *	@param point_2 The xyz of the second point of the line.
+		 *	@param color The rgb color of the line.
+		 */
+		void drawLine(const glm::vec3& point_1, const glm::vec3& point_2, const glm::vec3& color);
+
+		/**	@brief Draws prebuilt lines in one copy.
+		 *
+		 *	@param vertices The line vertices, two per line.
+		 */
+		void drawLines(const std::vector<ColoredVertex>& vertices);
+
+		/**	@brief Starts a new layer. Anything drawn afterwards
+		 *		   is submitted on top of everything before it.
+		 *
+		 *	@param space The coordinate space of the new layer.
+		 *
+		 *	@note Within a layer, triangles are drawn first,
+		 *		  then circles, then lines.
+		 */
+		void beginLayer(Space space = Space::WORLD);
+
+		/**	@brief Empties all buffers without releasing
+		 *		   their memory. Starts a world layer.
+		 */
+		void clear();
+
+		/**	@brief Sets the part of the world this frame
+		 *		   looks at.
+		 *
+		 *	@param view The visible world rectangle.
+		 */
+		void setView(const ViewBounds& view);
+
+		/**	@brief Gets the part of the world this frame
+		 *		   looks at.
+		 *
+		 *	@return Returns mView.
+		 */
+		const ViewBounds& getView() const;
+
+		/**	@brief Says whether nothing has been drawn since
+		 *		   the last clear.
+		 *
+		 *	@return Returns true if all buffers are empty.
+		 *			Otherwise, false.
+		 */
+		bool isEmpty() const;
+
+		/**	@brief Gets the layers drawn so far. There is
+		 *		   always at least one.
+		 *
+		 *	@return Returns mLayers.
+		 */
+		const std::vector<Layer>& getLayers() const;
+
+		/**	@brief Gets the circles drawn so far.
+		 *
+		 *	@return Returns mCircles.
+		 */
+		const std::vector<CircleInstance>& getCircles() const;
+
+		/**	@brief Gets the line vertices drawn so far,
+		 *		   two per line.
+		 *
+		 *	@return Returns mLineVertices.
+		 */
+		const std::vector<ColoredVertex>& getLineVertices() const;
+
+		/**	@brief Gets the triangle vertices drawn so far,
+		 *		   three per triangle.
+		 *
+		 *	@return Returns mTriangleVertices.
+		 */
+		const std::vector<ColoredVertex>& getTriangleVertices() const;
+
+	private:
+
+		ViewBounds mView;
+
+		std::vector<Layer> mLayers;
+		std::vector<CircleInstance> mCircles;
+		std::vector<ColoredVertex> mLineVertices;
+		std::vector<ColoredVertex> mTriangleVertices;
+	};
+}
@@ -5,6 +5,8 @@
 #include "EventQueue.h"
 #include "EventArgs.h"
 #include "Event.h"
+#include "Species.h"
+#include "World.h"
 
 using namespace Ecosim;
 using namespace std;
@@ -16,18 +18,14 @@ const uint32_t RESOURCE_POOL_SIZE = 25;
 const glm::vec3 RESOURCE_COLOR_FOOD = glm::vec3(0.9f, 0.7f, 0.4f);
 const glm::vec3 RESOURCE_COLOR_WATER = glm::vec3(0.4f, 0.6f, 0.8f);
 
-const float RESOURCE_SPAWNRATE_FOOD = 3.0f;
-const float RESOURCE_SPAWNRATE_WATER = 3.0f;
-
-const float RESOURCE_YIELD_FOOD = 0.2f;
-const float RESOURCE_YIELD_WATER = 0.2f;
-
 const float RESOURCE_LIFETIME = 30.0f;
 const float RESOURCE_SIZE = 10.0f;
 
+// scent
+const float SCENT_CELL_SIZE = 32.0f;
 
-Environment::Environment() :
-	mTime(0.0f)
+
+Environment::Environment()
 {
 	Event<ResourceDeactivate>::subscribe(*this);
 }
@@ -43,110 +41,152 @@ Environment::~Environment()
 
 void Environment::init()
 {
-	mTime = 0.0f;
-
-	uint64_t foodID = Resource<Food>::classTypeID();
-	uint64_t waterID = Resource<Water>::classTypeID();
+	const SimParams& params = World::current().getConfig().params;
 
 	// init resource stats
-	Resource<Food>::init(RESOURCE_COLOR_FOOD, RESOURCE_LIFETIME, RESOURCE_SIZE);
-	Resource<Water>::init(RESOURCE_COLOR_WATER, RESOURCE_LIFETIME, RESOURCE_SIZE);
+	Resource<Food>::init(RESOURCE_COLOR_FOOD, RESOURCE_LIFETIME, RESOURCE_SIZE, params.yieldFood);
+	Resource<Water>::init(RESOURCE_COLOR_WATER, RESOURCE_LIFETIME, RESOURCE_SIZE, params.yieldWater);
 
-	Food::setYields(RESOURCE_YIELD_FOOD);
-	Water::setYields(RESOURCE_YIELD_WATER);
+	// create pools and spawn timers
+	addResourceType<Food>(params.spawnRateFood);
+	addResourceType<Water>(params.spawnRateWater);
 
-	// init spawn functions
-	mResourceSpawnFuncs[foodID] = &Environment::spawnFood;
-	mResourceSpawnFuncs[waterID] = &Environment::spawnWater;
+	// start with as many of each type as the world asks for
+	uint32_t numResources = World::current().getConfig().numResources;
+	uint32_t numTypes = static_cast<uint32_t>(mPools.size());
+	for(uint32_t i = 0; i < numTypes; ++i)
+	{
+		mPools[i]->reserve(std::max(RESOURCE_POOL_SIZE, numResources));
+		for(uint32_t j = 0; j < numResources; ++j)
+		{
+			mPools[i]->spawn();
+		}
+		scheduleSpawn(i);
+	}
 
-	// init spawn times
-	mResourceSpawnTimes[foodID] = mResourceSpawnRates[foodID] = RESOURCE_SPAWNRATE_FOOD;
-	mResourceSpawnTimes[waterID] = mResourceSpawnRates[waterID] = RESOURCE_SPAWNRATE_WATER;
+	// one field for each type any species can smell
+	for(uint32_t i = 0; i < Species::COUNT; ++i)
+	{
+		const Species& species = Species::get(static_cast<Species::ID>(i));
+		for(uint32_t j = 0; j < species.numScentTypes; ++j)
+		{
+			uint64_t typeID = species.scentTypes[j]();
+			if(findScentField(typeID) == nullptr)
+			{
+				mScentFields.push_back(new ScentField(typeID, SCENT_CELL_SIZE));
+				mScentFields.back()->setBounds(World::current().getBounds());
+			}
+		}
+	}
+}
 
-	// create pools
-	mActivePools[foodID];
-	mActivePools[waterID];
+//-------------------------------------------------------------
 
-	ResourcePool& foodPool = mInactivePools[foodID];
-	ResourcePool& waterPool = mInactivePools[waterID];
+void Environment::shutdown()
+{
+	for(SpawnData& spawnData : mSpawnData)
+	{
+		TimerWheel::cancel(spawnData.timer);
+	}
+
+	// pools delete their resources
+	for(ResourcePool* pool : mPools)
+	{
+		delete pool;
+	}
+
+	mPools.clear();
+	mSpawnData.clear();
 
-	for(uint32_t i = 0; i < RESOURCE_POOL_SIZE; ++i)
+	for(ScentField* field : mScentFields)
 	{
-		foodPool.push_back(new Resource<Food>());
-		waterPool.push_back(new Resource<Water>());
+		delete field;
 	}
+	mScentFields.clear();
 }
 
 //-------------------------------------------------------------
 
-void Environment::shutdown()
+void Environment::update(const SimClock& clock)
 {
-	for(auto& iter : mActivePools)
-	{
-		ResourcePool& activePool = mActivePools[iter.first];
-		ResourcePool& inactivePool = mInactivePools[iter.first];
+	const SimParams& params = World::current().getConfig().params;
+	float deltaSeconds = clock.getDeltaTimeScaled();
 
-		// clear all resources in pools
-		for(IResource* resource : activePool)
-		{
-			delete resource;
-		}
-		for(IResource* resource : inactivePool)
+	float deposit = params.scentDeposit * deltaSeconds;
+	float spread = params.scentSpread * deltaSeconds;
+	float retention = std::max(0.0f, 1.0f - params.scentDecay * deltaSeconds);
+
+	for(ScentField* field : mScentFields)
+	{
+		for(const CollisionRegistry::Members* members : PhysicalCircle::getCollisionObjLists(field->getTypeID()))
 		{
-			delete resource;
+			for(PhysicalCircle* obj : *members)
+			{
+				// only objects that can be touched leave a scent
+				if(obj->isCollisionActive())
+				{
+					field->deposit(obj->getPosition(), deposit);
+				}
+			}
 		}
 
-		// clear pools
-		activePool.clear();
-		inactivePool.clear();
+		field->diffuse(spread, retention);
 	}
-
-	// clear all maps
-	mActivePools.clear();
-	mInactivePools.clear();
-	mResourceSpawnFuncs.clear();
-	mResourceSpawnTimes.clear();
-	mResourceSpawnRates.clear();
 }
 
 //-------------------------------------------------------------
 
-void Environment::update(const SimClock& clock)
+void Environment::render(DrawList& drawList)
 {
-	mTime += clock.getDeltaTimeScaled();
+	// only draw what the camera can see
+	const ViewBounds& view = drawList.getView();
+	PhysicalCircle::getSpatialIndex().query(view.min, view.max, mVisibleObjects);
 
-	// update resources
-	for(auto& iter : mActivePools)
+	for(PhysicalCircle* obj : mVisibleObjects)
 	{
-		uint64_t resourceID = iter.first;
-
-		// spawn resource if necessary
-		if(mTime > mResourceSpawnTimes[resourceID])
+		if(IResource* resource = obj->as<IResource>())
 		{
-			mResourceSpawnTimes[resourceID] = mTime + mResourceSpawnRates[resourceID];
-			mResourceSpawnFuncs[resourceID](*this);
+			resource->render(drawList);
 		}
+	}
+}
+
+//-------------------------------------------------------------
 
-		// update active resources
-		for(IResource* resource : mActivePools[resourceID])
+void Environment::hashState(EntityHashes& outHashes) const
+{
+	for(uint32_t typeOrdinal = 0; typeOrdinal < mPools.size(); ++typeOrdinal)
+	{
+		const ResourcePool& pool = *mPools[typeOrdinal];
+		for(uint32_t i = 0; i < pool.numActive(); ++i)
 		{
-			resource->update(clock);
+			StateHash hash;
+			pool[i].hashState(hash);
+			outHashes.push_back(EntityHash{ "Resource", typeOrdinal, i, hash.get() });
 		}
 	}
+
+	for(uint32_t i = 0; i < mScentFields.size(); ++i)
+	{
+		StateHash hash;
+		mScentFields[i]->hashState(hash);
+		outHashes.push_back(EntityHash{ "Scent", i, 0, hash.get() });
+	}
 }
 
 //-------------------------------------------------------------
 
-void Environment::render(Renderer& renderer)
+const ScentField* Environment::findScentField(uint64_t typeID) const
 {
-	for(auto& iter : mActivePools)
+	for(const ScentField* field : mScentFields)
 	{
-		// render active resources
-		for(IResource* resource : mActivePools[iter.first])
+		if(field->getTypeID() == typeID)
 		{
-			resource->render(renderer);
+			return field;
 		}
 	}
+
+	return nullptr;
 }
 
 //-------------------------------------------------------------
@@ -155,9 +195,13 @@ void Environment::notify(const IPublisher& e)
 {
 	if(Event<ResourceDeactivate>* resourceDeactivate = e.as<Event<ResourceDeactivate>>())
 	{
+		// the resource may have been destroyed while the event waited
 		const ResourceDeactivate& args = resourceDeactivate->message();
-		assert(args.resource != nullptr);
-		moveResource(*args.resource);
+		PhysicalCircle* obj = PhysicalCircle::find(args.resource);
+		if(IResource* resource = obj != nullptr ? obj->as<IResource>() : nullptr)
+		{
+			moveResource(*resource);
+		}
 	}
 }
 
@@ -165,54 +209,29 @@ void Environment::notify(const IPublisher& e)
 
 void Environment::moveResource(IResource& resource)
 {
-	uint64_t resourceID = resource.instanceTypeID();
-	ResourcePool& activePool = mActivePools[resourceID];
-	ResourcePool& inactivePool = mInactivePools[resourceID];
-
-	activePool.erase(remove(activePool.begin(), activePool.end(), &resource), activePool.end());
-	inactivePool.push_back(&resource);
+	assert(resource.getTypeOrdinal() < mPools.size());
+	mPools[resource.getTypeOrdinal()]->release(resource);
 }
 
 //-------------------------------------------------------------
 
-void Environment::spawnFood()
+template <typename T>
+void Environment::addResourceType(float spawnRate)
 {
-	uint64_t resourceID = Resource<Food>::classTypeID();
-
-	ResourcePool& mInactivePool = mInactivePools[resourceID];
-	ResourcePool& mActivePool = mActivePools[resourceID];
-
-	if(mInactivePool.empty())
-	{
-		mActivePool.push_back(new Resource<Food>());
-	}
-	else
-	{
-		mActivePool.push_back(mInactivePool.back());
-		mInactivePool.pop_back();
-	}
+	uint32_t typeOrdinal = static_cast<uint32_t>(mPools.size());
 
-	mActivePool.back()->activate();
+	mPools.push_back(new ResourcePool(typeOrdinal, []() -> IResource* { return new Resource<T>(); }));
+	mSpawnData.push_back(SpawnData{ spawnRate, TimerHandle() });
 }
 
 //-------------------------------------------------------------
 
-void Environment::spawnWater()
+void Environment::scheduleSpawn(uint32_t typeOrdinal)
 {
-	uint64_t resourceID = Resource<Water>::classTypeID();
-
-	ResourcePool& mInactivePool = mInactivePools[resourceID];
-	ResourcePool& mActivePool = mActivePools[resourceID];
-
-	if(mInactivePool.empty())
+	SpawnData& spawnData = mSpawnData[typeOrdinal];
+	spawnData.timer = TimerWheel::schedule(spawnData.spawnRate, [this, typeOrdinal]()
 	{
-		mActivePool.push_back(new Resource<Water>());
-	}
-	else
-	{
-		mActivePool.push_back(mInactivePool.back());
-		mInactivePool.pop_back();
-	}
-
-	mActivePool.back()->activate();
+		mPools[typeOrdinal]->spawn();
+		scheduleSpawn(typeOrdinal);
+	});
 }
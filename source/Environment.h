@@ -5,15 +5,25 @@
 
 #include "Resource.h"
 #include "ResourceEffects.h"
+#include "ResourcePool.h"
+#include "ScentField.h"
 
 namespace Ecosim
 {
 	/**	Simulation component that manages pools
 	 *	of Resource objects.
 	 *	
-	 *	These pools are sorted in maps by type,
-	 *	so Resource<Food>'s are kept separate
-	 *	from Resource<Water>'s.
+	 *	There is one pool per Resource type, so
+	 *	Resource<Food>'s are kept separate from
+	 *	Resource<Water>'s. Pools and spawn timers
+	 *	are kept in flat arrays indexed by each
+	 *	type's ordinal, which Resources carry.
+	 *
+	 *	Spawning and expiry are driven by the
+	 *	TimerWheel. The Environment's per-frame
+	 *	work is its ScentFields: one for each type
+	 *	some Species can smell, which every living
+	 *	object of that type deposits into.
 	 */
 	class Environment final : public ISimComponent, public ISubscriber
 	{
@@ -33,26 +43,47 @@ namespace Ecosim
 		~Environment();
 
 		/**	@brief Initializes the Resource pools
-		 *		   and Resource stats.
+		 *		   and Resource stats, spawns the
+		 *		   Resources the World starts with, and
+		 *		   creates the ScentFields.
 		 */
 		virtual void init() override;
 
-		/**	@brief Deletes all Resources.
+		/**	@brief Deletes all Resources and ScentFields.
 		 */
 		virtual void shutdown() override;
 
-		/**	@brief Spawns Resources on a timer and 
-		 *		   updates Resources in the active pool.
+		/**	@brief Has every object with a scent deposit
+		 *		   into its field, then spreads and decays
+		 *		   the fields.
 		 *
 		 *	@param clock The simulation's timekeeper.
 		 */
 		virtual void update(const SimClock& clock) override;
 
-		/**	@brief Renders all Resources in the active pool.
+		/**	@brief Renders the active Resources the camera
+		 *		   can see.
 		 *
-		 *	@param renderer The simulation rendering object.
+		 *	@param drawList The frame being drawn.
 		 */
-		virtual void render(Renderer& renderer) override;
+		virtual void render(DrawList& drawList) override;
+
+		/**	@brief Hashes the state of every active Resource,
+		 *		   pool by pool, in slot order, then every
+		 *		   ScentField.
+		 *
+		 *	@param outHashes Receives the hashes. Appended to.
+		 */
+		virtual void hashState(EntityHashes& outHashes) const override;
+
+		/**	@brief Finds the scent of a type.
+		 *
+		 *	@param typeID The type ID of the objects.
+		 *
+		 *	@return Returns the field, or nullptr if no
+		 *			Species smells the type.
+		 */
+		const ScentField* findScentField(std::uint64_t typeID) const;
 
 		/**	@brief Receives signals of Resource deactivation.
 		 *		   Moves the deactivated Resource from the
@@ -65,36 +96,41 @@ namespace Ecosim
 	private:
 
 		/**	@brief Moves the given Resource from the
-		 *		   active pool to the inactive pool.
+		 *		   active range of its pool to the inactive
+		 *		   range.
 		 *
 		 *	@param resource The deactivated Resource.
 		 */
 		void moveResource(IResource& resource);
 
-		/**	@brief Moves a Resource<Food> from the inactive
-		 *		   pool to the active pool. Creates a new
-		 *		   Resource<Food> in the active pool if the
-		 *		   inactive pool is empty.
+		/**	@brief Creates a pool for a Resource type and
+		 *		   gives the type the next ordinal.
+		 *
+		 *	@param spawnRate The seconds between spawns.
 		 */
-		void spawnFood();
+		template <typename T>
+		void addResourceType(float spawnRate);
 
-		/**	@brief Moves a Resource<Water> from the inactive
-		 *		   pool to the active pool. Creates a new
-		 *		   Resource<Water> in the active pool if the
-		 *		   inactive pool is empty.
+		/**	@brief Schedules the next spawn of a Resource
+		 *		   type. The timer spawns one Resource and
+		 *		   then reschedules itself.
+		 *
+		 *	@param typeOrdinal The Resource type to spawn.
 		 */
-		void spawnWater();
+		void scheduleSpawn(std::uint32_t typeOrdinal);
+
+
+		struct SpawnData
+		{
+			float spawnRate;
+			TimerHandle timer;
+		};
 
+		std::vector<ResourcePool*> mPools;
+		std::vector<SpawnData> mSpawnData;
 
-		typedef std::function<void(Environment&)> SpawnFunc;
-		typedef std::vector<IResource*> ResourcePool;
+		std::vector<ScentField*> mScentFields;
 
-		std::unordered_map<std::uint64_t, SpawnFunc> mResourceSpawnFuncs;	
-		std::unordered_map<std::uint64_t, ResourcePool> mInactivePools;
-		std::unordered_map<std::uint64_t, ResourcePool> mActivePools;
-		std::unordered_map<std::uint64_t, float> mResourceSpawnTimes;
-		std::unordered_map<std::uint64_t, float> mResourceSpawnRates;
-		
-		float mTime;
+		std::vector<PhysicalCircle*> mVisibleObjects;
 	};
 }
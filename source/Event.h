@@ -2,6 +2,7 @@
 #pragma once
 
 #include "IPublisher.h"
+#include "World.h"
 
 namespace Ecosim
 {
@@ -12,12 +13,14 @@ namespace Ecosim
 	 *	but it could be anything--int, Foo, etc.
 	 *
 	 *	Events use the publisher-subscriber pattern,
-	 *	so Event<T>'s store lists of subscribers that
-	 *	receive events of that type when delivered.
+	 *	so each World keeps lists of subscribers that
+	 *	receive Event<T>'s of a type when delivered.
 	 *
 	 *	These lists are unique to templates, so an
 	 *	Event<int>'s subscribers will not receive
 	 *	Event<float>'s unless they also subscribe.
+	 *	The static functions act on the lists of the
+	 *	current World.
 	 */
 	template <typename T>
 	class Event final : public IPublisher
@@ -63,7 +66,7 @@ namespace Ecosim
 		/** @brief Gets the number of objects registered
 		 *		   as subscribers for this Event type.
 		 *
-		 *	@return Returns the length of sSubscribers.
+		 *	@return Returns the length of the subscriber list.
 		 */
 		static std::uint32_t numSubscribers();
 
@@ -75,13 +78,18 @@ namespace Ecosim
 
 	private:
 
-		T mMsg;
+		/**	@brief Gets the subscribers to this Event type
+		 *		   in the current World.
+		 *
+		 *	@return Returns the subscriber list.
+		 */
+		static Subscribers& subscribers();
 
-		static Subscribers sSubscribers;
+
+		T mMsg;
 	};
 
 	template <typename T> RTTI_DEFINITIONS(Event<T>)
-	template <typename T> IPublisher::Subscribers Event<T>::sSubscribers;
 
 #include "Event.inl"
 }
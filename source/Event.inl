@@ -1,7 +1,7 @@
 
 template <typename T>
 Event<T>::Event(const T& msg) :
-	IPublisher(sSubscribers),
+	IPublisher(subscribers()),
 	mMsg(msg)
 {
 }
@@ -11,7 +11,7 @@ Event<T>::Event(const T& msg) :
 template <typename T>
 void Event<T>::subscribe(ISubscriber& sub)
 {
-	sSubscribers.push_back(&sub);
+	subscribers().push_back(&sub);
 }
 
 //-------------------------------------------------------------
@@ -19,7 +19,8 @@ void Event<T>::subscribe(ISubscriber& sub)
 template <typename T>
 void Event<T>::unsubscribe(ISubscriber& sub)
 {
-	sSubscribers.erase(std::remove(sSubscribers.begin(), sSubscribers.end(), &sub), sSubscribers.end());
+	Subscribers& subs = subscribers();
+	subs.erase(std::remove(subs.begin(), subs.end(), &sub), subs.end());
 }
 
 //-------------------------------------------------------------
@@ -27,7 +28,7 @@ void Event<T>::unsubscribe(ISubscriber& sub)
 template <typename T>
 void Event<T>::unsubscribeAll()
 {
-	sSubscribers.clear();
+	subscribers().clear();
 }
 
 //-------------------------------------------------------------
@@ -35,7 +36,7 @@ void Event<T>::unsubscribeAll()
 template <typename T>
 std::uint32_t Event<T>::numSubscribers()
 {
-	return static_cast<uint32_t>(sSubscribers.size());
+	return static_cast<uint32_t>(subscribers().size());
 }
 
 //-------------------------------------------------------------
@@ -45,3 +46,11 @@ const T& Event<T>::message() const
 {
 	return mMsg;
 }
+
+//-------------------------------------------------------------
+
+template <typename T>
+IPublisher::Subscribers& Event<T>::subscribers()
+{
+	return World::current().getSubscribers(classTypeID());
+}
@@ -1,22 +1,23 @@
 
 #pragma once
 
+#include "SlotMap.h"
+
 namespace Ecosim
 {
-	class IResource;
-	class Agent;
-
 	/**	Event argument for Resource deactivation.
+	 *	Holds the Resource's object handle.
 	 */
 	struct ResourceDeactivate
 	{
-		IResource* resource;
+		SlotHandle resource;
 	};
 
 	/**	Event argument for Agent death.
+	 *	Holds the Agent's object handle.
 	 */
 	struct AgentDeath
 	{
-		Agent* agent;
+		SlotHandle agent;
 	};
 }
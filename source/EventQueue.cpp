@@ -2,28 +2,11 @@
 #include "pch.h"
 #include "EventQueue.h"
 
+#include "World.h"
+
 using namespace Ecosim;
 using namespace std;
 
-EventQueue* EventQueue::sInstance = nullptr;
-
-EventQueue* EventQueue::instance()
-{
-	if(sInstance == nullptr)
-	{
-		sInstance = new EventQueue();
-	}
-	return sInstance;
-}
-
-//-------------------------------------------------------------
-
-EventQueue::EventQueue()
-{
-}
-
-//-------------------------------------------------------------
-
 void EventQueue::update()
 {
 	// don't want to trash event queue -- move contents to other queue
@@ -38,16 +21,14 @@ void EventQueue::update()
 
 //-------------------------------------------------------------
 
-void EventQueue::enqueue(IPublisher& publisher)
+void EventQueue::clear()
 {
-	assert(sInstance != nullptr);
-	sInstance->mEvents.push_back(shared_ptr<IPublisher>(&publisher));
+	mEvents.clear();
 }
 
 //-------------------------------------------------------------
 
-void EventQueue::clear()
+void EventQueue::enqueue(IPublisher& publisher)
 {
-	assert(sInstance != nullptr);
-	sInstance->mEvents.clear();
+	World::current().getEventQueue().mEvents.push_back(shared_ptr<IPublisher>(&publisher));
 }
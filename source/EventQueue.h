@@ -5,7 +5,8 @@
 
 namespace Ecosim
 {
-	/**	Singleton class that manages a queue of Events.
+	/**	Manages a queue of Events. Each World owns
+	 *	one.
 	 */
 	class EventQueue final
 	{
@@ -16,6 +17,10 @@ namespace Ecosim
 		EventQueue(EventQueue&& other) = delete;
 		EventQueue& operator=(EventQueue&& other) = delete;
 
+		/** @brief Constructor.
+		 */
+		EventQueue() = default;
+
 		/** @brief Destructor.
 		 */
 		~EventQueue() = default;
@@ -24,34 +29,21 @@ namespace Ecosim
 		 */
 		void update();
 
-		/**	@brief Adds a new event to the queue.
-		 *
-		 *	@param publisher The new event.
-		 */
-		static void enqueue(IPublisher& publisher);
-
 		/**	@brief Clears the queue without delivering
 		 *		   any of the enqueued events.
 		 */
-		static void clear();
+		void clear();
 
-		/**	@brief Gets the singleton instance of the
-		 *		   EventQueue.
+		/**	@brief Adds a new event to the queue of the
+		 *		   current World.
 		 *
-		 *	@return Returns a pointer to the EventQueue
-		 *			singleton.
+		 *	@param publisher The new event.
 		 */
-		static EventQueue* instance();
+		static void enqueue(IPublisher& publisher);
 
 	private:
 
-		/** @brief Constructor.
-		 */
-		EventQueue();
-
 		typedef std::vector<std::shared_ptr<IPublisher>> Events;
 		Events mEvents;
-
-		static EventQueue* sInstance;
 	};
 }
@@ -0,0 +1,161 @@
+#include "pch.h"
+#include "FarFieldGrid.h"
+
+using namespace Ecosim;
+using namespace std;
+using namespace glm;
+
+FarFieldGrid::FarFieldGrid(uint64_t typeID, float cellSize) :
+	mTypeID(typeID),
+	mCellSize(cellSize),
+	mInvCellSize(1.0f / cellSize),
+	mSide(1)
+{
+	assert(cellSize > 0.0f);
+	setBounds(vec2(cellSize, cellSize));
+}
+
+//-------------------------------------------------------------
+
+void FarFieldGrid::setBounds(const vec2& bounds)
+{
+	uint32_t numColumns = std::max(1u, static_cast<uint32_t>(ceil(bounds.x * mInvCellSize)));
+	uint32_t numRows = std::max(1u, static_cast<uint32_t>(ceil(bounds.y * mInvCellSize)));
+
+	// square, with a power of two side, so every coarser cell covers exactly four finer ones
+	mSide = 1;
+	uint32_t numLevels = 1;
+	while(mSide < std::max(numColumns, numRows))
+	{
+		mSide *= 2;
+		++numLevels;
+	}
+
+	// visits keep a fixed stack, three cells deep per level
+	assert(numLevels <= 20);
+
+	mLevels.resize(numLevels);
+	for(uint32_t level = 0; level < numLevels; ++level)
+	{
+		uint32_t side = mSide >> level;
+		mLevels[level].assign(side * side, Node{ vec3(0.0f), 0 });
+	}
+
+	mObjects.clear();
+	mCellStarts.assign(mSide * mSide + 1, 0);
+}
+
+//-------------------------------------------------------------
+
+void FarFieldGrid::build(const CollisionRegistry::Lists& objects)
+{
+	uint32_t numCells = mSide * mSide;
+	vector<Node>& finest = mLevels[0];
+
+	// count and sum positions per cell, remembering each object's cell for the fill pass
+	mCellStarts.assign(numCells + 1, 0);
+	mObjectCells.clear();
+	for(Node& node : finest)
+	{
+		node = Node{ vec3(0.0f), 0 };
+	}
+
+	for(const CollisionRegistry::Members* members : objects)
+	{
+		for(PhysicalCircle* obj : *members)
+		{
+			if(obj->isCollisionActive())
+			{
+				uint32_t cell = cellIndex(obj->getPosition());
+				mObjectCells.push_back(cell);
+				++mCellStarts[cell + 1];
+
+				finest[cell].centroid += obj->getPosition();
+				++finest[cell].count;
+			}
+		}
+	}
+
+	// prefix sum turns counts into start offsets
+	for(uint32_t i = 0; i < numCells; ++i)
+	{
+		mCellStarts[i + 1] += mCellStarts[i];
+	}
+
+	// fill cells -- a copy of the offsets serves as the write cursor per cell
+	mObjects.resize(mObjectCells.size());
+	vector<uint32_t> cursors(mCellStarts.begin(), mCellStarts.end() - 1);
+
+	uint32_t next = 0;
+	for(const CollisionRegistry::Members* members : objects)
+	{
+		for(PhysicalCircle* obj : *members)
+		{
+			if(obj->isCollisionActive())
+			{
+				mObjects[cursors[mObjectCells[next++]]++] = obj;
+			}
+		}
+	}
+
+	// each coarser cell sums the four under it, while the finer level still holds sums
+	for(uint32_t level = 1; level < mLevels.size(); ++level)
+	{
+		const vector<Node>& finer = mLevels[level - 1];
+		vector<Node>& coarser = mLevels[level];
+		uint32_t side = mSide >> level;
+
+		for(uint32_t y = 0; y < side; ++y)
+		{
+			for(uint32_t x = 0; x < side; ++x)
+			{
+				Node sum{ vec3(0.0f), 0 };
+				for(uint32_t child = 0; child < 4; ++child)
+				{
+					const Node& node = finer[(y * 2 + (child >> 1)) * side * 2 + x * 2 + (child & 1)];
+					sum.centroid += node.centroid;
+					sum.count += node.count;
+				}
+				coarser[y * side + x] = sum;
+			}
+		}
+	}
+
+	// sums become centroids once no coarser level needs them
+	for(vector<Node>& level : mLevels)
+	{
+		for(Node& node : level)
+		{
+			if(node.count != 0)
+			{
+				node.centroid /= static_cast<float>(node.count);
+			}
+		}
+	}
+}
+
+//-------------------------------------------------------------
+
+uint64_t FarFieldGrid::getTypeID() const
+{
+	return mTypeID;
+}
+
+//-------------------------------------------------------------
+
+uint32_t FarFieldGrid::size() const
+{
+	return static_cast<uint32_t>(mObjects.size());
+}
+
+//-------------------------------------------------------------
+
+uint32_t FarFieldGrid::cellIndex(const vec3& pos) const
+{
+	float column = pos.x * mInvCellSize;
+	float row = pos.y * mInvCellSize;
+
+	uint32_t x = column <= 0.0f ? 0 : std::min(static_cast<uint32_t>(column), mSide - 1);
+	uint32_t y = row <= 0.0f ? 0 : std::min(static_cast<uint32_t>(row), mSide - 1);
+	return y * mSide + x;
+}
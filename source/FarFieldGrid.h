@@ -0,0 +1,127 @@
+#pragma once
+
+#include "PhysicalCircle.h"
+
+namespace Ecosim
+{
+	/**	Pyramid of grids over the world that summarizes
+	 *	where the objects of one type are, for perception
+	 *	that approximates distant objects.
+	 *
+	 *	The finest level buckets objects with active
+	 *	collision by cell, as the SpatialGrid does. Each
+	 *	coarser level halves the resolution, and every
+	 *	cell keeps the count and centroid of the objects
+	 *	under it. A visit walks down from the single top
+	 *	cell, opening only cells that are large for their
+	 *	distance from the viewer; the rest are handed over
+	 *	whole, as a count at their centroid. Cells at the
+	 *	finest level hand over their objects one by one.
+	 *
+	 *	With opening threshold theta, a cell is handed over
+	 *	whole only when its width is under theta times its
+	 *	distance, so no object in it is further than
+	 *	sqrt(2) * theta * distance from the centroid. That
+	 *	bounds both the relative error of its distance and,
+	 *	in radians, of its bearing. For uniform crowds a
+	 *	visit touches O(log N) cells.
+	 */
+	class FarFieldGrid final
+	{
+	public:
+
+		FarFieldGrid(const FarFieldGrid& other) = delete;
+		FarFieldGrid& operator=(const FarFieldGrid& other) = delete;
+		FarFieldGrid(FarFieldGrid&& other) = delete;
+		FarFieldGrid& operator=(FarFieldGrid&& other) = delete;
+
+		/**	@brief Constructor.
+		 *
+		 *	@param typeID The type ID of the objects summarized.
+		 *	@param cellSize The width and height of each cell
+		 *					at the finest level.
+		 */
+		FarFieldGrid(std::uint64_t typeID, float cellSize);
+
+		/**	@brief Destructor.
+		 */
+		~FarFieldGrid() = default;
+
+		/**	@brief Sizes the grid to cover the world.
+		 *		   Empties the grid.
+		 *
+		 *	@param bounds The size of the world.
+		 */
+		void setBounds(const glm::vec2& bounds);
+
+		/**	@brief Buckets and summarizes every object with
+		 *		   active collision. Replaces the previous
+		 *		   contents of the grid.
+		 *
+		 *	@param objects The lists of objects to bucket.
+		 */
+		void build(const CollisionRegistry::Lists& objects);
+
+		/**	@brief Walks the grid from a viewpoint, handing
+		 *		   nearby objects over one at a time and
+		 *		   distant cells over as clusters.
+		 *
+		 *	@param pos The viewpoint.
+		 *	@param theta The opening threshold. Clamped to 0.5,
+		 *				 so the viewpoint's own cells always open.
+		 *	@param self An object to leave out, or nullptr.
+		 *	@param visitor Called with (position, count) for
+		 *				   each object or cluster.
+		 */
+		template <typename Visitor>
+		void visit(const glm::vec3& pos, float theta, const PhysicalCircle* self, Visitor& visitor) const;
+
+		/**	@brief Gets the type summarized.
+		 *
+		 *	@return Returns mTypeID.
+		 */
+		std::uint64_t getTypeID() const;
+
+		/**	@brief Gets the number of objects in the grid.
+		 *
+		 *	@return Returns the size of mObjects.
+		 */
+		std::uint32_t size() const;
+
+	private:
+
+		/**	Count and centroid of the objects under one cell.
+		 */
+		struct Node
+		{
+			glm::vec3 centroid;
+			std::uint32_t count;
+		};
+
+		/**	@brief Gets the index of the finest cell
+		 *		   holding a point.
+		 *
+		 *	@param pos The point.
+		 *
+		 *	@return Returns the index into the first level.
+		 */
+		std::uint32_t cellIndex(const glm::vec3& pos) const;
+
+
+		// level 0 is the finest, each side a power of two; the last is one cell
+		std::vector<std::vector<Node>> mLevels;
+
+		// objects packed by finest cell, as in the SpatialGrid
+		std::vector<PhysicalCircle*> mObjects;
+		std::vector<std::uint32_t> mCellStarts;
+		std::vector<std::uint32_t> mObjectCells;
+
+		std::uint64_t mTypeID;
+
+		float mCellSize;
+		float mInvCellSize;
+		std::uint32_t mSide;
+	};
+
+#include "FarFieldGrid.inl"
+}
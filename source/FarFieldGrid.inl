@@ -0,0 +1,56 @@
+
+template <typename Visitor>
+void FarFieldGrid::visit(const glm::vec3& pos, float theta, const PhysicalCircle* self, Visitor& visitor) const
+{
+	theta = SimMath::clampNum(theta, 0.0f, 0.5f);
+
+	struct Cell
+	{
+		std::uint32_t level;
+		std::uint32_t x;
+		std::uint32_t y;
+	};
+
+	// depth first -- each opened cell adds a net three, so this covers twenty levels
+	Cell stack[64];
+	std::uint32_t stackSize = 0;
+	stack[stackSize++] = Cell{ static_cast<std::uint32_t>(mLevels.size() - 1), 0, 0 };
+
+	while(stackSize > 0)
+	{
+		Cell cell = stack[--stackSize];
+		std::uint32_t side = mSide >> cell.level;
+		const Node& node = mLevels[cell.level][cell.y * side + cell.x];
+		if(node.count == 0)
+		{
+			continue;
+		}
+
+		if(cell.level == 0)
+		{
+			// close enough to count each object
+			std::uint32_t index = cell.y * side + cell.x;
+			for(std::uint32_t i = mCellStarts[index]; i < mCellStarts[index + 1]; ++i)
+			{
+				const PhysicalCircle* obj = mObjects[i];
+				if(obj != self)
+				{
+					visitor(obj->getPosition(), 1u);
+				}
+			}
+			continue;
+		}
+
+		float width = mCellSize * static_cast<float>(1u << cell.level);
+		if(width < theta * glm::length(node.centroid - pos))
+		{
+			visitor(node.centroid, node.count);
+			continue;
+		}
+
+		for(std::uint32_t child = 0; child < 4; ++child)
+		{
+			stack[stackSize++] = Cell{ cell.level - 1, cell.x * 2 + (child & 1), cell.y * 2 + (child >> 1) };
+		}
+	}
+}
@@ -2,11 +2,12 @@
 #include "pch.h"
 #include "Gene.h"
 
+#include "World.h"
+
 using namespace Ecosim;
 using namespace std;
 using namespace glm;
 
-uint32_t Gene::sInnovation = 0;
 
 Gene::Gene(uint32_t innovation, uint32_t source, uint32_t target, float weight, bool disabled) :
 	mInnovation(innovation),
@@ -46,6 +47,18 @@ Gene& Gene::operator=(const Gene& other)
 
 //-------------------------------------------------------------
 
+bool Gene::operator==(const Gene& other) const
+{
+	return
+		mInnovation == other.mInnovation &&
+		mSource == other.mSource &&
+		mTarget == other.mTarget &&
+		mWeight == other.mWeight &&
+		mIsDisabled == other.mIsDisabled;
+}
+
+//-------------------------------------------------------------
+
 void Gene::enable()
 {
 	mIsDisabled = false;
@@ -111,12 +124,12 @@ bool Gene::isDisabled() const
 
 void Gene::setNextInnovation(uint32_t innovation)
 {
-	sInnovation = innovation;
+	World::current().getGenomeCounters().nextInnovation = innovation;
 }
 
 //-------------------------------------------------------------
 
 uint32_t Gene::nextInnovation()
 {
-	return sInnovation++;
+	return World::current().getGenomeCounters().nextInnovation++;
 }
@@ -41,6 +41,16 @@ namespace Ecosim
 		 */
 		Gene& operator=(const Gene& other);
 
+		/**	@brief Equality operator.
+		 *
+		 *	@param other The other Gene.
+		 *
+		 *	@return Returns true if both Genes have the same
+		 *			historical marker, connection, weight, and
+		 *			enabled state. Otherwise, false.
+		 */
+		bool operator==(const Gene& other) const;
+
 		/**	@brief Destructor.
 		 */
 		~Gene() = default;
@@ -115,7 +125,8 @@ namespace Ecosim
 
 		/** @brief Gets the next historical marker for Genes.
 		 *
-		 *	@return Returns sInnovation, then increments it.
+		 *	@return Returns the current World's next innovation
+		 *			number, then increments it.
 		 */
 		static std::uint32_t nextInnovation();
 
@@ -128,7 +139,5 @@ namespace Ecosim
 		float mWeight;
 
 		bool mIsDisabled;
-
-		static std::uint32_t sInnovation;
 	};
 }
@@ -2,24 +2,26 @@
 #include "pch.h"
 #include "Genome.h"
 
+#include "World.h"
+
 using namespace Ecosim;
 using namespace std;
 using namespace glm;
 
-uint32_t Genome::sID = 0;
-uint32_t Genome::sHighestInnovParsed = static_cast<uint32_t>(0 - 1);
-uint32_t Genome::sHighestIDParsed = 0;
-
 vector<Genome::MutationRateData> Genome::sMutationFuncs = 
 {
-	{ 1.0f, &Genome::mutateWeights },
-	{ 0.075f, &Genome::mutateAddConnection },
-	{ 0.075f, &Genome::mutateAddNeuron },
-	{ 0.02f, &Genome::mutateDisable },
-	{ 0.02f, &Genome::mutateEnable }
+	{ &SimParams::mutateWeightsChance, &Genome::mutateWeights },
+	{ &SimParams::mutateAddConnectionChance, &Genome::mutateAddConnection },
+	{ &SimParams::mutateAddNeuronChance, &Genome::mutateAddNeuron },
+	{ &SimParams::mutateDisableChance, &Genome::mutateDisable },
+	{ &SimParams::mutateEnableChance, &Genome::mutateEnable }
 };
 
 Genome::Genome(uint32_t id, uint32_t numInputs, bool usesNEAT, bool isPrey) :
+	mGenes(make_shared<Genes>()),
+	mGeneHash(0),
+	mIsGeneHashValid(false),
+	mIsInterned(false),
 	mID(id),
 	mNumInputs(numInputs),
 	mNextNeuronID(NETWORK_MAX_IN),
@@ -36,18 +38,17 @@ Genome::Genome(const Genome& other) :
 	mNextNeuronID = other.mNextNeuronID;
 	mSizeGene = other.mSizeGene;
 
-	// copy all genes from other
-	for(Gene* gene : other.mGenes)
-	{
-		mGenes.push_back(new Gene(*gene));
-	}
+	// share other's genes -- we only take a private copy if one of us mutates
+	mGenes = other.mGenes;
+	mGeneHash = other.mGeneHash;
+	mIsGeneHashValid = other.mIsGeneHashValid;
+	mIsInterned = other.mIsInterned;
 }
 
 //-------------------------------------------------------------
 
 Genome::~Genome()
 {
-	clear();
 }
 
 //-------------------------------------------------------------
@@ -56,30 +57,36 @@ Genome* Genome::crossover(const Genome& other, bool isFitnessEqual) const
 {
 	Genome* newGenome = new Genome(nextID(), mNumInputs, mUsesNEAT, mIsPrey);
 
+	const Genes& myGenes = *mGenes;
+	const Genes& otherGenes = *other.mGenes;
+	Genes& childGenes = *newGenome->mGenes;
+
 	uint32_t myIndex = 0;
 	uint32_t otherIndex = 0;
-	uint32_t myLast = static_cast<uint32_t>(mGenes.size());
-	uint32_t otherLast = static_cast<uint32_t>(other.mGenes.size());
+	uint32_t myLast = static_cast<uint32_t>(myGenes.size());
+	uint32_t otherLast = static_cast<uint32_t>(otherGenes.size());
+
+	childGenes.reserve(isFitnessEqual ? myLast + otherLast : myLast);
 
 	// while within bounds for both gene lists
 	while(myIndex < myLast && otherIndex < otherLast)
 	{
-		Gene* myGene = mGenes[myIndex];
-		Gene* otherGene = other.mGenes[otherIndex];
-		uint32_t myInnov = myGene->getInnovation();
-		uint32_t otherInnov = otherGene->getInnovation();
+		const Gene& myGene = myGenes[myIndex];
+		const Gene& otherGene = otherGenes[otherIndex];
+		uint32_t myInnov = myGene.getInnovation();
+		uint32_t otherInnov = otherGene.getInnovation();
 
 		// matching innovation -- inherits gene from random parent
 		if(myInnov == otherInnov)
 		{
-			newGenome->mGenes.push_back(new Gene(Random::randomRange(0.0f, 100.0f) >= 50.0f ? *myGene : *otherGene));
+			childGenes.push_back(Random::randomRange(0.0f, 100.0f) >= 50.0f ? myGene : otherGene);
 			++myIndex; ++otherIndex;
 		}
 		
 		// disjoint -- our innovation is earlier than other's -- child inherits gene from us
 		else if(myInnov < otherInnov)
 		{
-			newGenome->mGenes.push_back(new Gene(*myGene));
+			childGenes.push_back(myGene);
 			++myIndex;
 		}
 
@@ -88,7 +95,7 @@ Genome* Genome::crossover(const Genome& other, bool isFitnessEqual) const
 		{
 			if(isFitnessEqual) 
 			{
-				newGenome->mGenes.push_back(new Gene(*otherGene));
+				childGenes.push_back(otherGene);
 			}
 			++otherIndex;
 		}
@@ -97,7 +104,7 @@ Genome* Genome::crossover(const Genome& other, bool isFitnessEqual) const
 	// has excess on our list
 	for(; myIndex < myLast; ++myIndex)
 	{
-		newGenome->mGenes.push_back(new Gene(*mGenes[myIndex]));
+		childGenes.push_back(myGenes[myIndex]);
 	}
 
 	// has excess on other list (only care if fitness is equal)
@@ -105,7 +112,7 @@ Genome* Genome::crossover(const Genome& other, bool isFitnessEqual) const
 	{
 		for(; otherIndex < otherLast; ++otherIndex)
 		{
-			newGenome->mGenes.push_back(new Gene(*other.mGenes[otherIndex]));
+			childGenes.push_back(otherGenes[otherIndex]);
 		}
 	}
 
@@ -124,10 +131,11 @@ void Genome::mutate(float fitness)
 {
 	if(mUsesNEAT)
 	{
-		// try each NEAT mutation type
+		// try each NEAT mutation type, with this world's odds
+		const SimParams& params = World::current().getConfig().params;
 		for(MutationRateData& mutation : sMutationFuncs)
 		{
-			if(Random::randomRange(0.0f, 1.0f) < mutation.probability)
+			if(Random::randomRange(0.0f, 1.0f) < params.*mutation.probability)
 			{
 				mutation.func(*this, fitness);
 			}
@@ -151,15 +159,24 @@ void Genome::mutate(float fitness)
 
 void Genome::mutateWeights(float fitness)
 {
-	// perturb connection weight on each gene
+	// draw a roll and a perturbation for every gene up front
 	float geneMutationChance = SimMath::mutationChanceFromFitness(fitness);
-	for(Gene* gene : mGenes)
+	uint32_t numGenes = getGenomeLength();
+
+	vector<float> rolls(numGenes * 2);
+	float* perturbations = rolls.data() + numGenes;
+	Random::fillRange(rolls.data(), numGenes, 0.0f, 1.0f);
+	Random::fillRange(perturbations, numGenes, -geneMutationChance * 2, geneMutationChance * 2);
+
+	// perturb connection weight on each gene
+	for(uint32_t i = 0; i < numGenes; ++i)
 	{
-		if(Random::randomRange(0.0f, 1.0f) < geneMutationChance)
+		if(rolls[i] < geneMutationChance)
 		{
 			// lower fitness = higher mutation chance and larger range of possible value changes
-			float geneWeight = gene->getWeight();
-			gene->setWeight(geneWeight + Random::randomRange(-geneMutationChance * 2, geneMutationChance * 2));
+			//		only detach from shared genes once something actually changes
+			Gene& gene = detachGenes()[i];
+			gene.setWeight(gene.getWeight() + perturbations[i]);
 		}
 	}
 }
@@ -186,17 +203,19 @@ void Genome::mutateAddConnection(float fitness)
 void Genome::mutateAddNeuron(float fitness)
 {
 	UNREFERENCED_PARAMETER(fitness);
-	if(!mGenes.empty())
+	if(!mGenes->empty())
 	{
 		// mutate add neuron if random gene is enabled
-		Gene* gene = mGenes[Random::randomRange(0, 100000) % mGenes.size()];
-		if(!gene->isDisabled())
+		uint32_t index = static_cast<uint32_t>(Random::randomRange(0, static_cast<int32_t>(mGenes->size())));
+		if(!(*mGenes)[index].isDisabled())
 		{
-			gene->disable();
+			// copy out the gene -- adding genes below may reallocate the list
+			Gene gene = (*mGenes)[index];
+			detachGenes()[index].disable();
 
 			// add new link from original source to new neuron, and from new neuron to original target
-			addGene(Gene::nextInnovation(), gene->getSource(), mNextNeuronID, Random::randomRange(-1.0f, 1.0f), false);
-			addGene(Gene::nextInnovation(), mNextNeuronID, gene->getTarget(), gene->getWeight(), false);
+			addGene(Gene::nextInnovation(), gene.getSource(), mNextNeuronID, Random::randomRange(-1.0f, 1.0f), false);
+			addGene(Gene::nextInnovation(), mNextNeuronID, gene.getTarget(), gene.getWeight(), false);
 
 			++mNextNeuronID;
 		}
@@ -208,11 +227,14 @@ void Genome::mutateAddNeuron(float fitness)
 void Genome::mutateDisable(float fitness)
 {
 	UNREFERENCED_PARAMETER(fitness);
-	if(!mGenes.empty())
+	if(!mGenes->empty())
 	{
 		// disables random neuron
-		Gene* gene = mGenes[Random::randomRange(0, 100000) % mGenes.size()];
-		gene->disable();
+		uint32_t index = static_cast<uint32_t>(Random::randomRange(0, static_cast<int32_t>(mGenes->size())));
+		if(!(*mGenes)[index].isDisabled())
+		{
+			detachGenes()[index].disable();
+		}
 	}
 }
 
@@ -221,11 +243,14 @@ void Genome::mutateDisable(float fitness)
 void Genome::mutateEnable(float fitness)
 {
 	UNREFERENCED_PARAMETER(fitness);
-	if(!mGenes.empty())
+	if(!mGenes->empty())
 	{
 		// enables random neuron
-		Gene* gene = mGenes[Random::randomRange(0, 100000) % mGenes.size()];
-		gene->enable();
+		uint32_t index = static_cast<uint32_t>(Random::randomRange(0, static_cast<int32_t>(mGenes->size())));
+		if((*mGenes)[index].isDisabled())
+		{
+			detachGenes()[index].enable();
+		}
 	}
 }
 
@@ -245,17 +270,17 @@ uint32_t Genome::randomNeuronID(bool canReturnSensor)
 	if(canReturnSensor && selection < selectInputProbability)
 	{
 		// returning input neuron id
-		returnID = Random::randomRange(0, NETWORK_MAX_NODES) % mNumInputs;
+		returnID = Random::randomRange(0, static_cast<int32_t>(mNumInputs));
 	}
 	else if(numHidden > 0 && selection >= selectInputProbability && selection < 1.0f - selectOutputProbability)
 	{
 		// have hidden nodes, returning hidden neuron id
-		returnID = NETWORK_MAX_IN + Random::randomRange(0, NETWORK_MAX_NODES) % numHidden;
+		returnID = NETWORK_MAX_IN + Random::randomRange(0, static_cast<int32_t>(numHidden));
 	}
 	else
 	{
 		// returning output neuron id
-		returnID = NETWORK_MAX_NODES + Random::randomRange(0, NETWORK_MAX_NODES) % NETWORK_NUM_OUT;
+		returnID = NETWORK_MAX_NODES + Random::randomRange(0, NETWORK_NUM_OUT);
 	}
 
 	return returnID;
@@ -263,23 +288,28 @@ uint32_t Genome::randomNeuronID(bool canReturnSensor)
 
 //-------------------------------------------------------------
 
-void Genome::readFromFile(ifstream& file)
+void Genome::readFromStream(istream& stream)
 {
 	// read size trait
-	file >> mSizeGene;
+	stream >> mSizeGene;
 
 	// read in all gene definitions
 	uint32_t numGenes;
-	file >> numGenes;
+	stream >> numGenes;
 
 	uint32_t innovation, source, target;
 	float weight;
 	bool isDisabled;
 
+	GenomeCounters& counters = World::current().getGenomeCounters();
+
+	Genes& genes = detachGenes();
+	genes.reserve(genes.size() + numGenes);
+
 	for(uint32_t i = 0; i < numGenes; ++i)
 	{
-		file >> innovation >> source >> target >> weight >> isDisabled;
-		mGenes.push_back(new Gene(innovation, source, target, weight, isDisabled));
+		stream >> innovation >> source >> target >> weight >> isDisabled;
+		genes.emplace_back(innovation, source, target, weight, isDisabled);
 
 		// track highest neuron id we've seen
 		if(source >= mNextNeuronID && source < NETWORK_MAX_NODES - 1)
@@ -291,46 +321,53 @@ void Genome::readFromFile(ifstream& file)
 			mNextNeuronID = target + 1;
 		}
 
-		// track highest innovation number we've seen
-		if(innovation > sHighestInnovParsed)
+		// track highest innovation number we've seen -- UINT32_MAX means none yet
+		if(counters.highestInnovParsed == UINT32_MAX || innovation > counters.highestInnovParsed)
 		{
-			sHighestInnovParsed = innovation;
+			counters.highestInnovParsed = innovation;
 		}
 	}
 
 	// track highest genome id number we've seen
-	if(mID > sHighestIDParsed)
+	if(mID > counters.highestIDParsed)
 	{
-		sHighestIDParsed = mID;
+		counters.highestIDParsed = mID;
 	}
 }
 
 //-------------------------------------------------------------
 
-void Genome::writeToFile() const
+void Genome::writeToStream(ostream& stream) const
 {
-	ofstream genomeFile;
-	stringstream filePath;
-	filePath << DIR_GENOMES << "genome_" << mID << ".ini";
-	genomeFile.open(filePath.str().c_str(), ofstream::out | ofstream::trunc);
-
 	// write header information
-	genomeFile << mID << endl << mUsesNEAT << endl << mIsPrey << endl; 
+	stream << mID << endl << mUsesNEAT << endl << mIsPrey << endl; 
 
 	// write size trait
-	genomeFile << mSizeGene << endl;
+	stream << mSizeGene << endl;
 
 	// write each gene definition
-	genomeFile << mGenes.size() << endl;
-	for(Gene* gene : mGenes)
+	stream << mGenes->size() << endl;
+	for(const Gene& gene : *mGenes)
 	{
-		genomeFile << 
-			gene->getInnovation() << " " <<
-			gene->getSource() << " " <<
-			gene->getTarget() << " " <<
-			gene->getWeight() << " " <<
-			gene->isDisabled() << endl;
+		stream << 
+			gene.getInnovation() << " " <<
+			gene.getSource() << " " <<
+			gene.getTarget() << " " <<
+			gene.getWeight() << " " <<
+			gene.isDisabled() << endl;
 	}
+}
+
+//-------------------------------------------------------------
+
+void Genome::writeToFile() const
+{
+	ofstream genomeFile;
+	stringstream filePath;
+	filePath << DIR_GENOMES << "genome_" << mID << ".ini";
+	genomeFile.open(filePath.str().c_str(), ofstream::out | ofstream::trunc);
+
+	writeToStream(genomeFile);
 
 	genomeFile.close();
 }
@@ -339,28 +376,25 @@ void Genome::writeToFile() const
 
 void Genome::addGene(uint32_t innovation, uint32_t source, uint32_t target, float weight, bool disabled)
 {
-	mGenes.push_back(new Gene(innovation, source, target, weight, disabled));
+	detachGenes().emplace_back(innovation, source, target, weight, disabled);
 }
 
 //-------------------------------------------------------------
 
 void Genome::clear()
 {
-	for(Gene* gene : mGenes)
-	{
-		delete gene;
-	}
-	mGenes.clear();
+	// drop our reference to the genes -- anyone sharing them keeps theirs
+	mGenes = make_shared<Genes>();
+	mIsGeneHashValid = false;
+	mIsInterned = false;
 }
 
 //-------------------------------------------------------------
 
 const Gene& Genome::operator[](uint32_t index) const
 {
-	assert(index < mGenes.size());
-	assert(mGenes[index] != nullptr);
-
-	return *mGenes[index];
+	assert(index < mGenes->size());
+	return (*mGenes)[index];
 }
 
 //-------------------------------------------------------------
@@ -368,9 +402,9 @@ const Gene& Genome::operator[](uint32_t index) const
 bool Genome::hasGene(uint32_t source, uint32_t target) const
 {
 	bool hasGene = false;
-	for(Gene* gene : mGenes)
+	for(const Gene& gene : *mGenes)
 	{
-		if(gene->getSource() == source && gene->getTarget() == target)
+		if(gene.getSource() == source && gene.getTarget() == target)
 		{
 			hasGene = true;
 			break;
@@ -390,7 +424,7 @@ float Genome::getSizeGene() const
 
 uint32_t Genome::getGenomeLength() const
 {
-	return static_cast<uint32_t>(mGenes.size());
+	return static_cast<uint32_t>(mGenes->size());
 }
 
 //-------------------------------------------------------------
@@ -416,14 +450,59 @@ bool Genome::isPrey() const
 
 //-------------------------------------------------------------
 
+uint64_t Genome::getGeneHash() const
+{
+	if(!mIsGeneHashValid)
+	{
+		// hash field by field -- Gene has padding we don't want to feed the hash
+		uint64_t hash = SimMath::HASH_SEED;
+		for(const Gene& gene : *mGenes)
+		{
+			uint32_t innovation = gene.getInnovation();
+			uint32_t source = gene.getSource();
+			uint32_t target = gene.getTarget();
+			float weight = gene.getWeight();
+			bool isDisabled = gene.isDisabled();
+
+			hash = SimMath::hashBytes(&innovation, sizeof(innovation), hash);
+			hash = SimMath::hashBytes(&source, sizeof(source), hash);
+			hash = SimMath::hashBytes(&target, sizeof(target), hash);
+			hash = SimMath::hashBytes(&weight, sizeof(weight), hash);
+			hash = SimMath::hashBytes(&isDisabled, sizeof(isDisabled), hash);
+		}
+
+		mGeneHash = hash;
+		mIsGeneHashValid = true;
+	}
+
+	return mGeneHash;
+}
+
+//-------------------------------------------------------------
+
+Genome::Genes& Genome::detachGenes()
+{
+	// someone else can see these genes -- take a private copy before writing
+	if(mIsInterned || mGenes.use_count() > 1)
+	{
+		mGenes = make_shared<Genes>(*mGenes);
+		mIsInterned = false;
+	}
+
+	mIsGeneHashValid = false;
+	return *mGenes;
+}
+
+//-------------------------------------------------------------
+
 void Genome::setNextID(std::uint32_t id)
 {
-	sID = id;
+	World::current().getGenomeCounters().nextID = id;
 }
 
 //-------------------------------------------------------------
 
 uint32_t Genome::nextID()
 {
-	return sID++;
+	return World::current().getGenomeCounters().nextID++;
 }
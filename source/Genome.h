@@ -2,20 +2,32 @@
 #pragma once
 
 #include "Gene.h"
+#include "SimParams.h"
 
 namespace Ecosim
 {
 	class AgentManager;
+	class GenomeCache;
 
 	/**	Manages a list of Gene objects. The "genotype"
 	 *	of an Agent that describes the topology of its
 	 *	NeuralNetwork.
+	 *
+	 *	The Gene list is shared copy-on-write. Copies of
+	 *	a Genome point at the same list, and Genomes with
+	 *	identical content are folded onto one list by the
+	 *	GenomeCache. A private copy is only made when a
+	 *	mutation actually changes a Gene.
 	 */
 	class Genome final
 	{
 		friend class AgentManager;
+		friend class GenomeCache;
+
 	public:
 
+		typedef std::vector<Gene> Genes;
+
 		Genome(Genome&& other) = delete;
 		Genome& operator=(Genome&& other) = delete;
 		Genome& operator=(const Genome& other) = delete;
@@ -58,11 +70,19 @@ namespace Ecosim
 		 */
 		void mutate(float fitness);
 
-		/**	@brief Populates this Genome with Genes defined in a file.
+		/**	@brief Populates this Genome with Genes read from a
+		 *		   stream, in the format written by writeToStream.
 		 *
-		 *	@param file The filestream for this Genome.
+		 *	@param stream The stream positioned after the header
+		 *				  (ID, NEAT flag, and Prey flag).
 		 */
-		void readFromFile(std::ifstream& file);
+		void readFromStream(std::istream& stream);
+
+		/**	@brief Writes this Genome, header included, to a stream.
+		 *
+		 *	@param stream The stream to write to.
+		 */
+		void writeToStream(std::ostream& stream) const;
 
 		/**	@brief Saves this Genome to a file so that it may be loaded
 		 *		   in the same state for a new run of the simulation.
@@ -137,8 +157,25 @@ namespace Ecosim
 		 */
 		bool isPrey() const;
 
+		/**	@brief Gets a hash of the Gene list. Genomes with
+		 *		   equal hashes are assumed to express the same
+		 *		   NeuralNetwork, and are checked for equality
+		 *		   by the GenomeCache.
+		 *
+		 *	@return Returns the content hash of mGenes.
+		 */
+		std::uint64_t getGeneHash() const;
+
 	private:
 
+		/**	@brief Makes a private copy of the Gene list if it
+		 *		   is shared with another Genome or with the
+		 *		   GenomeCache. Call before writing to mGenes.
+		 *
+		 *	@return Returns a writable reference to the Gene list.
+		 */
+		Genes& detachGenes();
+
 		/**	@brief Has a random chance to perturb the connection weight
 		 *		   of each Gene. This random chance is based on fitness.
 		 *
@@ -193,14 +230,19 @@ namespace Ecosim
 
 		/** @brief Gets the next Genome ID.
 		 *
-		 *	@return Returns sID, then increments it.
+		 *	@return Returns the current World's next Genome ID,
+		 *			then increments it.
 		 */
 		static std::uint32_t nextID();
 
 		
-		std::vector<Gene*> mGenes;
+		std::shared_ptr<Genes> mGenes;
 		float mSizeGene;
 
+		mutable std::uint64_t mGeneHash;
+		mutable bool mIsGeneHashValid;
+		bool mIsInterned;
+
 		std::uint32_t mID;
 		std::uint32_t mNumInputs;
 		std::uint32_t mNextNeuronID;
@@ -208,15 +250,11 @@ namespace Ecosim
 		bool mUsesNEAT;
 		bool mIsPrey;
 
-		static std::uint32_t sID;
-		static std::uint32_t sHighestInnovParsed;
-		static std::uint32_t sHighestIDParsed;
-
 
 		typedef std::function<void(Genome&, float)> MutationFunc;
 		struct MutationRateData
 		{
-			float probability;
+			SimParams::Field probability;
 			MutationFunc func;
 		};
 		static std::vector<MutationRateData> sMutationFuncs;
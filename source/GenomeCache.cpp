@@ -0,0 +1,156 @@
+#include "pch.h"
+#include "GenomeCache.h"
+
+using namespace Ecosim;
+using namespace std;
+using namespace glm;
+
+// created up front -- every world shares it, so the first call may come from any thread
+GenomeCache* GenomeCache::sInstance = new GenomeCache();
+
+GenomeCache* GenomeCache::instance()
+{
+	return sInstance;
+}
+
+//-------------------------------------------------------------
+
+void GenomeCache::internGenes(Genome& genome)
+{
+	if(genome.mIsInterned)
+	{
+		return;
+	}
+
+	// lists we lock but don't use may be the last reference if another world just let go
+	//		they must outlive the lock, since dropping them re-enters the cache
+	vector<shared_ptr<Genome::Genes>> rejected;
+	uint64_t hash = genome.getGeneHash();
+
+	lock_guard<mutex> lock(mMutex);
+
+	// look for an identical list -- equal hashes are compared in full
+	auto range = mGeneLists.equal_range(hash);
+	for(auto iter = range.first; iter != range.second; ++iter)
+	{
+		shared_ptr<Genome::Genes> cached = iter->second.ref.lock();
+		if(cached != nullptr && *cached == *genome.mGenes)
+		{
+			genome.mGenes = cached;
+			genome.mIsInterned = true;
+			return;
+		}
+		rejected.push_back(std::move(cached));
+	}
+
+	// new content -- cache a list that removes itself when its last genome lets go
+	//		take over the genome's list if nobody else is looking at it
+	Genome::Genes* genes = genome.mGenes.use_count() > 1 ?
+		new Genome::Genes(*genome.mGenes) :
+		new Genome::Genes(std::move(*genome.mGenes));
+
+	genome.mGenes = shared_ptr<Genome::Genes>(genes, [this, hash](Genome::Genes* released)
+	{
+		releaseGenes(hash, released);
+	});
+	genome.mIsInterned = true;
+
+	mGeneLists.insert(make_pair(hash, GeneListEntry{ genes, genome.mGenes }));
+}
+
+//-------------------------------------------------------------
+
+shared_ptr<const NetworkTopology> GenomeCache::acquireNetwork(const Genome& genome, uint32_t numInputs)
+{
+	// the same genes wired to a different number of sensors is a different network
+	uint64_t key = SimMath::hashBytes(&numInputs, sizeof(numInputs), genome.getGeneHash());
+
+	lock_guard<mutex> lock(mMutex);
+
+	auto range = mNetworks.equal_range(key);
+	for(auto iter = range.first; iter != range.second; ++iter)
+	{
+		NetworkEntry& entry = iter->second;
+		if(entry.numInputs != numInputs)
+		{
+			continue;
+		}
+
+		if(entry.genes == genome.mGenes || *entry.genes == *genome.mGenes)
+		{
+			shared_ptr<const NetworkTopology> cached = entry.ref.lock();
+			if(cached != nullptr)
+			{
+				return cached;
+			}
+		}
+	}
+
+	// not compiled yet -- build it and cache a topology that removes itself when released
+	NetworkTopology* network = new NetworkTopology(genome, numInputs);
+	shared_ptr<const NetworkTopology> result(network, [this, key](const NetworkTopology* released)
+	{
+		releaseNetwork(key, released);
+	});
+
+	mNetworks.insert(make_pair(key, NetworkEntry{ network, result, genome.mGenes, numInputs }));
+	return result;
+}
+
+//-------------------------------------------------------------
+
+uint32_t GenomeCache::numGeneLists() const
+{
+	lock_guard<mutex> lock(mMutex);
+	return static_cast<uint32_t>(mGeneLists.size());
+}
+
+//-------------------------------------------------------------
+
+uint32_t GenomeCache::numNetworks() const
+{
+	lock_guard<mutex> lock(mMutex);
+	return static_cast<uint32_t>(mNetworks.size());
+}
+
+//-------------------------------------------------------------
+
+void GenomeCache::releaseGenes(uint64_t hash, Genome::Genes* genes)
+{
+	lock_guard<mutex> lock(mMutex);
+
+	auto range = mGeneLists.equal_range(hash);
+	for(auto iter = range.first; iter != range.second; ++iter)
+	{
+		if(iter->second.genes == genes)
+		{
+			mGeneLists.erase(iter);
+			break;
+		}
+	}
+
+	delete genes;
+}
+
+//-------------------------------------------------------------
+
+void GenomeCache::releaseNetwork(uint64_t key, const NetworkTopology* network)
+{
+	// pull the entry out before destroying it -- it holds a reference to the genes
+	//		and has to be dropped after unlocking, since releasing genes locks too
+	shared_ptr<const Genome::Genes> genes;
+	lock_guard<mutex> lock(mMutex);
+
+	auto range = mNetworks.equal_range(key);
+	for(auto iter = range.first; iter != range.second; ++iter)
+	{
+		if(iter->second.network == network)
+		{
+			genes = std::move(iter->second.genes);
+			mNetworks.erase(iter);
+			break;
+		}
+	}
+
+	delete network;
+}
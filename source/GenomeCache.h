@@ -0,0 +1,120 @@
+#pragma once
+
+#include "Genome.h"
+#include "NetworkTopology.h"
+
+namespace Ecosim
+{
+	/**	Singleton content-addressed cache of Gene lists
+	 *	and compiled NetworkTopologies.
+	 *
+	 *	Entries are keyed by Genome::getGeneHash() and
+	 *	reference counted through shared_ptr. Identical
+	 *	Genomes are folded onto one Gene list, and every
+	 *	NeuralNetwork built from an identical Genome uses
+	 *	the same topology. An entry is dropped from the
+	 *	cache as soon as its last user releases it.
+	 *
+	 *	One cache serves every World in the process, so
+	 *	all access is guarded by a mutex. References may
+	 *	be released from any thread.
+	 */
+	class GenomeCache final
+	{
+	public:
+
+		GenomeCache(const GenomeCache& other) = delete;
+		GenomeCache& operator=(const GenomeCache& other) = delete;
+		GenomeCache(GenomeCache&& other) = delete;
+		GenomeCache& operator=(GenomeCache&& other) = delete;
+
+		/**	@brief Destructor.
+		 */
+		~GenomeCache() = default;
+
+		/**	@brief Points a Genome at the cached copy of its
+		 *		   Gene list, or adds its list to the cache if
+		 *		   no identical list is cached yet.
+		 *
+		 *	@param genome The Genome to intern.
+		 */
+		void internGenes(Genome& genome);
+
+		/**	@brief Gets the compiled network for a Genome,
+		 *		   building it if no identical Genome has been
+		 *		   compiled yet.
+		 *
+		 *	@param genome The Genome to compile.
+		 *	@param numInputs The number of sensor Neurons.
+		 *
+		 *	@return Returns a shared reference to the topology.
+		 */
+		std::shared_ptr<const NetworkTopology> acquireNetwork(const Genome& genome, std::uint32_t numInputs);
+
+		/**	@brief Gets the number of distinct Gene lists
+		 *		   currently in use.
+		 *
+		 *	@return Returns the length of mGeneLists.
+		 */
+		std::uint32_t numGeneLists() const;
+
+		/**	@brief Gets the number of distinct topologies
+		 *		   currently in use.
+		 *
+		 *	@return Returns the length of mNetworks.
+		 */
+		std::uint32_t numNetworks() const;
+
+		/**	@brief Gets the singleton instance of the
+		 *		   GenomeCache.
+		 *
+		 *	@return Returns a pointer to the GenomeCache
+		 *			singleton.
+		 */
+		static GenomeCache* instance();
+
+	private:
+
+		/**	@brief Constructor.
+		 */
+		GenomeCache() = default;
+
+		/**	@brief Removes a Gene list from the cache once
+		 *		   its last reference is released.
+		 *
+		 *	@param hash The content hash of the list.
+		 *	@param genes The released list.
+		 */
+		void releaseGenes(std::uint64_t hash, Genome::Genes* genes);
+
+		/**	@brief Removes a topology from the cache once
+		 *		   its last reference is released.
+		 *
+		 *	@param key The cache key of the topology.
+		 *	@param network The released topology.
+		 */
+		void releaseNetwork(std::uint64_t key, const NetworkTopology* network);
+
+
+		struct GeneListEntry
+		{
+			const Genome::Genes* genes;
+			std::weak_ptr<Genome::Genes> ref;
+		};
+
+		struct NetworkEntry
+		{
+			const NetworkTopology* network;
+			std::weak_ptr<const NetworkTopology> ref;
+			std::shared_ptr<const Genome::Genes> genes;
+			std::uint32_t numInputs;
+		};
+
+		std::unordered_multimap<std::uint64_t, GeneListEntry> mGeneLists;
+		std::unordered_multimap<std::uint64_t, NetworkEntry> mNetworks;
+
+		mutable std::mutex mMutex;
+
+		static GenomeCache* sInstance;
+	};
+}
@@ -17,12 +17,10 @@ namespace Ecosim
 	{
 		RTTI_DECLARATIONS(IPublisher, RTTI)
 
-	protected:
+	public:
 
 		typedef std::vector<ISubscriber*> Subscribers;
 
-	public:
-
 		IPublisher(const IPublisher& other) = delete;
 		IPublisher& operator=(const IPublisher& other) = delete;
 		IPublisher(IPublisher&& other) = delete;
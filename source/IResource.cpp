@@ -14,8 +14,10 @@ RTTI_DEFINITIONS(IResource)
 
 IResource::IResource(float size, const vec3& pos) :
 	PhysicalCircle(size, pos),
-	mTimeActive(0.0f),
-	mIsActive(false)
+	mActivationTime(0.0),
+	mIsActive(false),
+	mTypeOrdinal(0),
+	mPoolIndex(0)
 {
 	registerObj(*this);
 }
@@ -24,7 +26,7 @@ IResource::IResource(float size, const vec3& pos) :
 
 IResource::~IResource()
 {
-	unregisterObj(*this);
+	TimerWheel::cancel(mExpiryTimer);
 }
 
 //-------------------------------------------------------------
@@ -32,7 +34,11 @@ IResource::~IResource()
 void IResource::activate()
 {
 	mIsActive = true;
-	mTimeActive = 0.0f;
+	mActivationTime = TimerWheel::getTime();
+
+	// expire once the type's lifetime is up, unless consumed first
+	TimerWheel::cancel(mExpiryTimer);
+	mExpiryTimer = TimerWheel::schedule(getLifetime(), [this]() { deactivate(); });
 
 	const glm::vec2& bounds = getBounds();
 	setPosition(vec3(Random::randomRange(0.0f, bounds.x), Random::randomRange(0.0f, bounds.y), 0.0f));
@@ -45,9 +51,10 @@ void IResource::activate()
 void IResource::deactivate()
 {
 	mIsActive = false;
+	TimerWheel::cancel(mExpiryTimer);
 
 	ResourceDeactivate args;
-	args.resource = this;
+	args.resource = getHandle();
 	EventQueue::enqueue(*new Event<ResourceDeactivate>(args));
 
 	deactivateCollision();
@@ -57,7 +64,7 @@ void IResource::deactivate()
 
 float IResource::getTimeActive() const
 {
-	return mTimeActive;
+	return static_cast<float>(TimerWheel::getTime() - mActivationTime);
 }
 
 //-------------------------------------------------------------
@@ -65,4 +72,35 @@ float IResource::getTimeActive() const
 bool IResource::isActive() const
 {
 	return mIsActive;
-}
\ No newline at end of file
+}
+
+//-------------------------------------------------------------
+
+void IResource::hashState(StateHash& hash) const
+{
+	hash.add(static_cast<uint64_t>(mIsActive));
+	hash.add(mPosition);
+	hash.add(mActivationTime);
+}
+
+//-------------------------------------------------------------
+
+void IResource::setPoolSlot(uint32_t typeOrdinal, uint32_t poolIndex)
+{
+	mTypeOrdinal = typeOrdinal;
+	mPoolIndex = poolIndex;
+}
+
+//-------------------------------------------------------------
+
+uint32_t IResource::getTypeOrdinal() const
+{
+	return mTypeOrdinal;
+}
+
+//-------------------------------------------------------------
+
+uint32_t IResource::getPoolIndex() const
+{
+	return mPoolIndex;
+}
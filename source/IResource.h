@@ -2,6 +2,8 @@
 #pragma once
 
 #include "PhysicalCircle.h"
+#include "TimerWheel.h"
+#include "StateHash.h"
 
 namespace Ecosim
 {
@@ -33,21 +35,31 @@ namespace Ecosim
 
 		/**	@brief Resets this object's age and
 		 *		   collision. Gives it a new position.
+		 *		   Schedules its expiry.
 		 */
 		void activate();
 
 		/**	@brief Deactivates this object's collision.
-		 *		   Sends a signal notifying the Environment.
+		 *		   Cancels its expiry and sends a signal
+		 *		   notifying the Environment.
 		 */
 		void deactivate();
 
 		/** @brief Gets the length of time this object
 		 *		   has been active.
 		 *
-		 *	@return Returns mTimeActive.
+		 *	@return Returns the simulation time since
+		 *			mActivationTime.
 		 */
 		float getTimeActive() const;
 
+		/**	@brief Gets the maximum age of this object's
+		 *		   Resource type.
+		 *
+		 *	@return Returns the lifetime, in seconds.
+		 */
+		virtual float getLifetime() const = 0;
+
 		/**	@brief Says whether this object is active.
 		 *
 		 *	@return Returns true if this object is active.
@@ -55,9 +67,46 @@ namespace Ecosim
 		 */
 		bool isActive() const;
 
+		/**	@brief Mixes this object's activity, position,
+		 *		   and activation time into a hash.
+		 *
+		 *	@param hash The hash being built.
+		 */
+		void hashState(StateHash& hash) const;
+
+		/**	@brief Records where this object lives in its
+		 *		   ResourcePool.
+		 *
+		 *	@param typeOrdinal The small index of this object's
+		 *					   Resource type.
+		 *	@param poolIndex The slot this object occupies.
+		 */
+		void setPoolSlot(std::uint32_t typeOrdinal, std::uint32_t poolIndex);
+
+		/**	@brief Gets the small index of this object's
+		 *		   Resource type, used to find its pool.
+		 *
+		 *	@return Returns mTypeOrdinal.
+		 */
+		std::uint32_t getTypeOrdinal() const;
+
+		/**	@brief Gets the slot this object occupies in
+		 *		   its ResourcePool.
+		 *
+		 *	@return Returns mPoolIndex.
+		 */
+		std::uint32_t getPoolIndex() const;
+
 	protected:
 
-		float mTimeActive;
+		double mActivationTime;
 		bool mIsActive;
+
+	private:
+
+		TimerHandle mExpiryTimer;
+
+		std::uint32_t mTypeOrdinal;
+		std::uint32_t mPoolIndex;
 	};
 }
@@ -35,7 +35,9 @@ namespace Ecosim
 		/**	@brief Applies some effect to an Agent.
 		 *
 		 *	@param agent The colliding Agent.
+		 *	@param yield The strength of the effect, shared by
+		 *				 every Resource of the same type.
 		 */
-		virtual void applyEffect(Agent& agent) = 0;
+		virtual void applyEffect(Agent& agent, float yield) = 0;
 	};
 }
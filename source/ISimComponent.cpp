@@ -27,7 +27,14 @@ void ISimComponent::update(const SimClock& clock)
 
 //-------------------------------------------------------------
 
-void ISimComponent::render(Renderer& renderer)
+void ISimComponent::render(DrawList& drawList)
 {
-	UNREFERENCED_PARAMETER(renderer);
+	UNREFERENCED_PARAMETER(drawList);
+}
+
+//-------------------------------------------------------------
+
+void ISimComponent::hashState(EntityHashes& outHashes) const
+{
+	UNREFERENCED_PARAMETER(outHashes);
 }
@@ -2,9 +2,10 @@
 #pragma once
 
 #include "SimClock.h"
-#include "Renderer.h"
+#include "DrawList.h"
 
 #include "RTTI.h"
+#include "StateHash.h"
 
 namespace Ecosim
 {
@@ -46,8 +47,15 @@ namespace Ecosim
 
 		/**	@brief Render function.
 		 *
-		 *	@param renderer The simulation rendering object.
+		 *	@param drawList The frame being drawn.
 		 */
-		virtual void render(Renderer& renderer);
+		virtual void render(DrawList& drawList);
+
+		/**	@brief Hashes the state of every object this
+		 *		   component owns, one entry per object.
+		 *
+		 *	@param outHashes Receives the hashes. Appended to.
+		 */
+		virtual void hashState(EntityHashes& outHashes) const;
 	};
 }
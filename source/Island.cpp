@@ -0,0 +1,158 @@
+#include "pch.h"
+#include "Island.h"
+
+using namespace Ecosim;
+using namespace std::chrono;
+using namespace std;
+using namespace glm;
+
+// each island's genome IDs and innovations start this far past the last
+const uint32_t ISLAND_COUNTER_STRIDE = 1 << 20;
+
+const float SECONDS_PER_MINUTE = 60.0f;
+
+Island::Island(uint32_t index, const IslandConfig& config) :
+	mConfig(config),
+	mIndex(index)
+{
+}
+
+//-------------------------------------------------------------
+
+Island::~Island()
+{
+	join();
+}
+
+//-------------------------------------------------------------
+
+void Island::addNeighbor(Island& neighbor)
+{
+	assert(&neighbor != this);
+	mNeighbors.push_back(&neighbor);
+}
+
+//-------------------------------------------------------------
+
+void Island::start()
+{
+	assert(!mThread.joinable());
+	mThread = std::thread(&Island::run, this);
+}
+
+//-------------------------------------------------------------
+
+void Island::join()
+{
+	if(mThread.joinable())
+	{
+		mThread.join();
+	}
+}
+
+//-------------------------------------------------------------
+
+void Island::post(string genome)
+{
+	mMailbox.post(std::move(genome));
+}
+
+//-------------------------------------------------------------
+
+uint32_t Island::getIndex() const
+{
+	return mIndex;
+}
+
+//-------------------------------------------------------------
+
+const IslandStats& Island::getStats() const
+{
+	return mStats;
+}
+
+//-------------------------------------------------------------
+
+void Island::run()
+{
+	World::Scope scope(mWorld);
+
+	// islands share the genome files, but never write them back or log to them
+	WorldConfig worldConfig;
+	worldConfig.bounds = mConfig.worldSize;
+	worldConfig.seed = mConfig.seed + mIndex;
+	worldConfig.savesGenomes = false;
+	worldConfig.logsFitness = false;
+	mWorld.init(worldConfig);
+
+	// move this island's counters into their own range
+	GenomeCounters& counters = mWorld.getGenomeCounters();
+	counters.nextInnovation += mIndex * ISLAND_COUNTER_STRIDE;
+	counters.nextID += mIndex * ISLAND_COUNTER_STRIDE;
+
+	float endTime = mConfig.duration * SECONDS_PER_MINUTE;
+	float migrationInterval = mConfig.migrationInterval * SECONDS_PER_MINUTE;
+	float nextMigration = migrationInterval;
+
+	steady_clock::time_point startTime = steady_clock::now();
+	while(mClock.getTotalTime() < endTime)
+	{
+		mClock.step(mConfig.timeStep);
+		mWorld.update(mClock);
+		++mStats.numTicks;
+
+		if(mClock.getTotalTime() >= nextMigration)
+		{
+			sendEmigrants();
+			receiveImmigrants();
+			nextMigration += migrationInterval;
+		}
+	}
+	mStats.elapsedSeconds = duration_cast<duration<double>>(steady_clock::now() - startTime).count();
+
+	const AgentManager& agentManager = mWorld.getAgentManager();
+	mStats.prey = agentManager.getFitnessSummary(true);
+	mStats.predator = agentManager.getFitnessSummary(false);
+
+	mWorld.shutdown();
+}
+
+//-------------------------------------------------------------
+
+void Island::sendEmigrants()
+{
+	mWorld.getAgentManager().collectElites(mConfig.numElites, mElites);
+
+	for(const Agent* elite : mElites)
+	{
+		stringstream genome;
+		elite->getGenome().writeToStream(genome);
+
+		for(Island* neighbor : mNeighbors)
+		{
+			if(mConfig.migrationRate >= 1.0f || Random::randomRange(0.0f, 1.0f) < mConfig.migrationRate)
+			{
+				neighbor->post(genome.str());
+				++mStats.numEmigrants;
+			}
+		}
+	}
+}
+
+//-------------------------------------------------------------
+
+void Island::receiveImmigrants()
+{
+	mArrivals.clear();
+	mMailbox.collect(mArrivals);
+
+	AgentManager& agentManager = mWorld.getAgentManager();
+	for(const string& genome : mArrivals)
+	{
+		istringstream stream(genome);
+		if(agentManager.receiveMigrant(stream))
+		{
+			++mStats.numImmigrants;
+		}
+	}
+}
@@ -0,0 +1,160 @@
+#pragma once
+
+#include "AgentManager.h"
+#include "Mailbox.h"
+#include "World.h"
+
+namespace Ecosim
+{
+	/**	Ways islands can be linked for migration.
+	 */
+	enum class MigrationTopology
+	{
+		RING,				// each island sends to the next
+		FULLY_CONNECTED		// each island sends to every other
+	};
+
+	//=============================================================
+
+	/**	Collection of data used to initialize
+	 *	an IslandCoordinator and its Islands.
+	 */
+	struct IslandConfig
+	{
+		glm::vec2 worldSize;
+
+		std::uint32_t numIslands = 4;
+		MigrationTopology topology = MigrationTopology::RING;
+
+		float migrationInterval = 5.0f;		// simulated minutes
+		float migrationRate = 1.0f;			// chance an elite goes to a given neighbor
+		std::uint32_t numElites = 2;		// per species
+
+		float duration = 60.0f;				// simulated minutes
+		float timeStep = 1.0f / 60.0f;		// simulated seconds per tick
+		std::uint64_t seed = 0;				// island i seeds its World with seed + i
+	};
+
+	//=============================================================
+
+	/**	Results of one Island's run.
+	 */
+	struct IslandStats
+	{
+		FitnessSummary prey;
+		FitnessSummary predator;
+
+		std::uint32_t numEmigrants = 0;
+		std::uint32_t numImmigrants = 0;
+
+		std::uint64_t numTicks = 0;
+		double elapsedSeconds = 0.0;
+	};
+
+	//=============================================================
+
+	/**	One World evolving on its own thread, trading
+	 *	its fittest Genomes with neighboring Islands.
+	 *
+	 *	Genomes travel as text, in the same format as
+	 *	the Genome files, through each Island's Mailbox.
+	 *	An Island never touches another's World; it only
+	 *	posts to their mailboxes, and drains its own
+	 *	between ticks.
+	 *
+	 *	Each Island's Genome ID and Gene innovation
+	 *	counters start in their own range, so innovations
+	 *	made on different Islands never share a number
+	 *	when migrants cross over with natives.
+	 */
+	class Island final
+	{
+	public:
+
+		Island(const Island& other) = delete;
+		Island& operator=(const Island& other) = delete;
+		Island(Island&& other) = delete;
+		Island& operator=(Island&& other) = delete;
+
+		/**	@brief Constructor.
+		 *
+		 *	@param index The Island's position among its peers.
+		 *	@param config The config data shared by all Islands.
+		 */
+		Island(std::uint32_t index, const IslandConfig& config);
+
+		/**	@brief Destructor. Waits for the thread to finish.
+		 */
+		~Island();
+
+		/**	@brief Adds an Island that this one sends
+		 *		   emigrants to.
+		 *
+		 *	@param neighbor The neighbor.
+		 */
+		void addNeighbor(Island& neighbor);
+
+		/**	@brief Starts running the World on its own thread.
+		 */
+		void start();
+
+		/**	@brief Waits for the World to finish running.
+		 */
+		void join();
+
+		/**	@brief Posts a serialized Genome to this Island.
+		 *		   Any thread may call this.
+		 *
+		 *	@param genome The Genome, as written by
+		 *				  Genome::writeToStream. Moved.
+		 */
+		void post(std::string genome);
+
+		/**	@brief Gets the Island's position among its peers.
+		 *
+		 *	@return Returns mIndex.
+		 */
+		std::uint32_t getIndex() const;
+
+		/**	@brief Gets the results of the run. Only valid
+		 *		   after join().
+		 *
+		 *	@return Returns mStats.
+		 */
+		const IslandStats& getStats() const;
+
+	private:
+
+		/**	@brief Runs the World for the configured duration,
+		 *		   migrating at every interval. Runs on the
+		 *		   Island's thread.
+		 */
+		void run();
+
+		/**	@brief Serializes the fittest Agents' Genomes and
+		 *		   posts them to the neighbors.
+		 */
+		void sendEmigrants();
+
+		/**	@brief Drains the mailbox, handing each Genome to
+		 *		   the AgentManager.
+		 */
+		void receiveImmigrants();
+
+
+		World mWorld;
+		SimClock mClock;
+
+		Mailbox<std::string> mMailbox;
+		std::vector<std::string> mArrivals;
+		std::vector<const Agent*> mElites;
+
+		std::vector<Island*> mNeighbors;
+		std::thread mThread;
+
+		const IslandConfig& mConfig;
+		IslandStats mStats;
+
+		std::uint32_t mIndex;
+	};
+}
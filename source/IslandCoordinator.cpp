@@ -0,0 +1,88 @@
+#include "pch.h"
+#include "IslandCoordinator.h"
+
+#include <iomanip>
+
+using namespace Ecosim;
+using namespace std;
+using namespace glm;
+
+void IslandCoordinator::init(const IslandConfig& config)
+{
+	mConfig = config;
+
+	mIslands.clear();
+	for(uint32_t i = 0; i < mConfig.numIslands; ++i)
+	{
+		mIslands.push_back(std::make_unique<Island>(i, mConfig));
+	}
+
+	// link islands for migration
+	uint32_t numIslands = mConfig.numIslands;
+	for(uint32_t i = 0; i < numIslands && numIslands > 1; ++i)
+	{
+		switch(mConfig.topology)
+		{
+		case MigrationTopology::RING:
+			mIslands[i]->addNeighbor(*mIslands[(i + 1) % numIslands]);
+			break;
+
+		case MigrationTopology::FULLY_CONNECTED:
+			for(uint32_t j = 0; j < numIslands; ++j)
+			{
+				if(j != i)
+				{
+					mIslands[i]->addNeighbor(*mIslands[j]);
+				}
+			}
+			break;
+		}
+	}
+}
+
+//-------------------------------------------------------------
+
+int32_t IslandCoordinator::run()
+{
+	if(mIslands.empty())
+	{
+		return -1;
+	}
+
+	for(auto& island : mIslands)
+	{
+		island->start();
+	}
+
+	for(auto& island : mIslands)
+	{
+		island->join();
+	}
+
+	printSummary();
+	return 0;
+}
+
+//-------------------------------------------------------------
+
+void IslandCoordinator::printSummary() const
+{
+	cout << setw(6) << "island" <<
+		setw(12) << "prey best" << setw(12) << "prey mean" <<
+		setw(12) << "pred best" << setw(12) << "pred mean" <<
+		setw(8) << "sent" << setw(8) << "recv" <<
+		setw(12) << "ticks/s" << endl;
+
+	cout << fixed << setprecision(3);
+	for(const auto& island : mIslands)
+	{
+		const IslandStats& stats = island->getStats();
+		double ticksPerSecond = stats.elapsedSeconds > 0.0 ? stats.numTicks / stats.elapsedSeconds : 0.0;
+
+		cout << setw(6) << island->getIndex() <<
+			setw(12) << stats.prey.best << setw(12) << stats.prey.mean <<
+			setw(12) << stats.predator.best << setw(12) << stats.predator.mean <<
+			setw(8) << stats.numEmigrants << setw(8) << stats.numImmigrants <<
+			setw(12) << setprecision(1) << ticksPerSecond << setprecision(3) << endl;
+	}
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "Island.h"
+
+namespace Ecosim
+{
+	/**	Runs several Islands side by side, one per
+	 *	thread, linked by a migration topology, then
+	 *	reports how each one fared.
+	 */
+	class IslandCoordinator final
+	{
+	public:
+
+		IslandCoordinator(const IslandCoordinator& other) = delete;
+		IslandCoordinator& operator=(const IslandCoordinator& other) = delete;
+		IslandCoordinator(IslandCoordinator&& other) = delete;
+		IslandCoordinator& operator=(IslandCoordinator&& other) = delete;
+
+		/**	@brief Constructor.
+		 */
+		IslandCoordinator() = default;
+
+		/**	@brief Destructor.
+		 */
+		~IslandCoordinator() = default;
+
+		/**	@brief Creates the Islands and links them
+		 *		   according to the topology.
+		 *
+		 *	@param config The config data. Copied.
+		 */
+		void init(const IslandConfig& config);
+
+		/**	@brief Runs every Island to completion, then
+		 *		   prints a summary of the results.
+		 *
+		 *	@return Returns 0 if the run completes. Returns
+		 *			-1 if there are no Islands to run.
+		 */
+		int32_t run();
+
+	private:
+
+		/**	@brief Prints one row per Island, showing fitness
+		 *		   per species, migration counts, and
+		 *		   throughput.
+		 */
+		void printSummary() const;
+
+
+		IslandConfig mConfig;
+		std::vector<std::unique_ptr<Island>> mIslands;
+	};
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+namespace Ecosim
+{
+	/**	Lock-free handoff of values from any number of
+	 *	producer threads to one consumer thread.
+	 *
+	 *	Posting pushes a node onto an intrusive stack with
+	 *	a single compare-exchange. Collecting swaps the
+	 *	whole stack out at once and reverses it, so values
+	 *	come out in the order they were posted. Since the
+	 *	consumer never pops single nodes, the stack is
+	 *	free of the ABA problem without tagged pointers.
+	 */
+	template <typename T>
+	class Mailbox final
+	{
+	public:
+
+		Mailbox(const Mailbox& other) = delete;
+		Mailbox& operator=(const Mailbox& other) = delete;
+		Mailbox(Mailbox&& other) = delete;
+		Mailbox& operator=(Mailbox&& other) = delete;
+
+		/**	@brief Constructor.
+		 */
+		Mailbox();
+
+		/**	@brief Destructor. Deletes any values that
+		 *		   were never collected.
+		 */
+		~Mailbox();
+
+		/**	@brief Posts a value. Any thread may call this.
+		 *
+		 *	@param value The value to post. Moved.
+		 */
+		void post(T value);
+
+		/**	@brief Takes every value posted so far, in the
+		 *		   order they were posted. Only the consumer
+		 *		   thread may call this.
+		 *
+		 *	@param outValues Receives the values. Appended to.
+		 *
+		 *	@return Returns the number of values taken.
+		 */
+		std::uint32_t collect(std::vector<T>& outValues);
+
+	private:
+
+		struct Node
+		{
+			T value;
+			Node* next;
+		};
+
+		std::atomic<Node*> mHead;
+	};
+
+#include "Mailbox.inl"
+}
@@ -0,0 +1,64 @@
+
+template <typename T>
+Mailbox<T>::Mailbox() :
+	mHead(nullptr)
+{
+}
+
+//-------------------------------------------------------------
+
+template <typename T>
+Mailbox<T>::~Mailbox()
+{
+	Node* node = mHead.load(std::memory_order_acquire);
+	while(node != nullptr)
+	{
+		Node* next = node->next;
+		delete node;
+		node = next;
+	}
+}
+
+//-------------------------------------------------------------
+
+template <typename T>
+void Mailbox<T>::post(T value)
+{
+	Node* node = new Node{ std::move(value), mHead.load(std::memory_order_relaxed) };
+
+	// on failure, node->next is refreshed with the current head
+	while(!mHead.compare_exchange_weak(node->next, node, std::memory_order_release, std::memory_order_relaxed))
+	{
+	}
+}
+
+//-------------------------------------------------------------
+
+template <typename T>
+std::uint32_t Mailbox<T>::collect(std::vector<T>& outValues)
+{
+	Node* node = mHead.exchange(nullptr, std::memory_order_acquire);
+
+	// the stack is newest first -- reverse it into posting order
+	Node* reversed = nullptr;
+	while(node != nullptr)
+	{
+		Node* next = node->next;
+		node->next = reversed;
+		reversed = node;
+		node = next;
+	}
+
+	std::uint32_t count = 0;
+	while(reversed != nullptr)
+	{
+		Node* next = reversed->next;
+		outValues.push_back(std::move(reversed->value));
+		delete reversed;
+
+		reversed = next;
+		++count;
+	}
+
+	return count;
+}
@@ -0,0 +1,142 @@
+#include "pch.h"
+#include "NetworkOverlay.h"
+
+using namespace Ecosim;
+using namespace std;
+using namespace glm;
+
+const vec3 SENSOR_ORIGIN(15.0f, 15.0f, 0.0f);
+const vec3 HIDDEN_ORIGIN(750.0f, 240.0f, 0.0f);
+const vec3 OUTPUT_ORIGIN(1000.0f, 420.0f, 0.0f);
+
+const float NEURON_RADIUS = 10.0f;
+const float NEURON_VERT_OFFSET = NEURON_RADIUS + 20.0f;
+const float NEURON_HORIZ_OFFSET = NEURON_RADIUS + 20.0f;
+
+namespace
+{
+	/**	Red for negative values, green for positive ones.
+	 */
+	vec3 signedColor(float value)
+	{
+		if(value < 0.0f)
+		{
+			return vec3(SimMath::lerp(glm::abs(value), 0.0f, 1.0f), 0.0f, 0.1f);
+		}
+
+		return vec3(0.0f, SimMath::lerp(value, 0.0f, 1.0f), 0.1f);
+	}
+
+	/**	Pulls a hidden Neuron toward a Neuron connected
+	 *	to it, keeping it between the sensor and output
+	 *	columns.
+	 */
+	void pullHidden(const Neuron& neuron, vec3& position, const vec3& other)
+	{
+		if(neuron.getType() == Neuron::Type::HIDDEN)
+		{
+			position.x = 0.7f * position.x + 0.3f * other.x;
+			position.y = 0.7f * position.y + 0.3f * other.y;
+
+			if(position.x >= other.x)
+			{
+				position.x -= NEURON_HORIZ_OFFSET;
+			}
+			if(position.x < SENSOR_ORIGIN.x + NEURON_HORIZ_OFFSET * 2)
+			{
+				position.x = SENSOR_ORIGIN.x + NEURON_HORIZ_OFFSET * 2;
+			}
+			else if(position.x > OUTPUT_ORIGIN.x - NEURON_HORIZ_OFFSET)
+			{
+				position.x = OUTPUT_ORIGIN.x - NEURON_HORIZ_OFFSET;
+			}
+		}
+	}
+}
+
+//-------------------------------------------------------------
+
+void NetworkOverlay::render(DrawList& drawList, const NeuralNetwork& network)
+{
+	const shared_ptr<const NetworkTopology>& topology = network.getTopology();
+	if(topology == nullptr)
+	{
+		return;
+	}
+
+	if(topology != mTopology)
+	{
+		rebuild(topology);
+	}
+
+	// connections never change for a topology, only the neuron colors do
+	drawList.drawLines(mConnectionVertices);
+
+	const vector<float>& values = network.getValues();
+	for(size_t i = 0; i < mNeuronPositions.size(); ++i)
+	{
+		drawList.drawColoredCircle(mNeuronPositions[i], NEURON_RADIUS, signedColor(values[i]));
+	}
+}
+
+//-------------------------------------------------------------
+
+void NetworkOverlay::clear()
+{
+	mTopology.reset();
+	mNeuronPositions.clear();
+	mConnectionVertices.clear();
+}
+
+//-------------------------------------------------------------
+
+void NetworkOverlay::rebuild(const shared_ptr<const NetworkTopology>& topology)
+{
+	// holding the topology keeps it alive, so a new one can never reuse its address
+	mTopology = topology;
+
+	const vector<Neuron*>& neurons = mTopology->getNeurons();
+	const vector<NetworkTopology::Connection>& connections = mTopology->getConnections();
+
+	// sensors and outputs stack in columns, hidden neurons start in the middle
+	mNeuronPositions.resize(neurons.size());
+	for(size_t i = 0; i < neurons.size(); ++i)
+	{
+		const Neuron& neuron = *neurons[i];
+		switch(neuron.getType())
+		{
+		case Neuron::Type::SENSOR:
+			mNeuronPositions[i] = SENSOR_ORIGIN;
+			mNeuronPositions[i].y += neuron.getID() * NEURON_VERT_OFFSET;
+			break;
+
+		case Neuron::Type::OUTPUT:
+			mNeuronPositions[i] = OUTPUT_ORIGIN;
+			mNeuronPositions[i].y += (neuron.getID() - NETWORK_MAX_NODES) * NEURON_VERT_OFFSET;
+			break;
+
+		case Neuron::Type::HIDDEN:
+			mNeuronPositions[i] = HIDDEN_ORIGIN;
+			break;
+		}
+	}
+
+	// hidden neurons drift toward whatever they connect to, in gene order
+	for(const NetworkTopology::Connection& connection : connections)
+	{
+		vec3& source = mNeuronPositions[connection.source];
+		vec3& target = mNeuronPositions[connection.target];
+
+		pullHidden(*neurons[connection.source], source, target);
+		pullHidden(*neurons[connection.target], target, source);
+	}
+
+	mConnectionVertices.clear();
+	mConnectionVertices.reserve(connections.size() * 2);
+	for(const NetworkTopology::Connection& connection : connections)
+	{
+		vec3 color = signedColor(connection.weight);
+		mConnectionVertices.push_back(ColoredVertex{ vec2(mNeuronPositions[connection.target]), color });
+		mConnectionVertices.push_back(ColoredVertex{ vec2(mNeuronPositions[connection.source]), color });
+	}
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "NeuralNetwork.h"
+
+namespace Ecosim
+{
+	/**	Screen-space drawing of one NeuralNetwork.
+	 *
+	 *	Only the selected Agent's network is ever shown,
+	 *	so Neuron layout is worked out here, on demand,
+	 *	rather than for every network that gets built.
+	 *	The layout and the connection lines depend only
+	 *	on the network topology, so they are cached and
+	 *	rebuilt only when the drawn topology changes --
+	 *	when another Agent is selected, or when the
+	 *	selected Agent respawns with a new Genome. Each
+	 *	frame only the Neuron colors are recomputed.
+	 */
+	class NetworkOverlay final
+	{
+	public:
+
+		NetworkOverlay(const NetworkOverlay& other) = delete;
+		NetworkOverlay& operator=(const NetworkOverlay& other) = delete;
+		NetworkOverlay(NetworkOverlay&& other) = delete;
+		NetworkOverlay& operator=(NetworkOverlay&& other) = delete;
+
+		/**	@brief Constructor.
+		 */
+		NetworkOverlay() = default;
+
+		/**	@brief Destructor.
+		 */
+		~NetworkOverlay() = default;
+
+		/**	@brief Draws a network's Neurons and the connections
+		 *		   between them. The color of a Neuron is based
+		 *		   on its output value. The color of a connection
+		 *		   is based on its weight.
+		 *
+		 *	@param drawList The frame being drawn.
+		 *	@param network The network to draw.
+		 */
+		void render(DrawList& drawList, const NeuralNetwork& network);
+
+		/**	@brief Drops the cached geometry.
+		 */
+		void clear();
+
+	private:
+
+		/**	@brief Lays out the Neurons of a topology and
+		 *		   builds the lines between them.
+		 *
+		 *	@param topology The topology to lay out.
+		 */
+		void rebuild(const std::shared_ptr<const NetworkTopology>& topology);
+
+
+		std::shared_ptr<const NetworkTopology> mTopology;
+
+		std::vector<glm::vec3> mNeuronPositions;
+		std::vector<ColoredVertex> mConnectionVertices;
+	};
+}
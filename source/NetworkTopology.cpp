@@ -0,0 +1,143 @@
+#include "pch.h"
+#include "NetworkTopology.h"
+
+using namespace Ecosim;
+using namespace std;
+using namespace glm;
+
+NetworkTopology::NetworkTopology(const Genome& genome, uint32_t numInputs) :
+	mNumInputs(numInputs)
+{
+	// neurons keyed by ID -- ordered so evaluation runs sensors, then hidden, then outputs
+	map<uint32_t, Neuron*> neurons;
+
+	// add input nodes to the network
+	for(uint32_t i = 0; i < mNumInputs; ++i)
+	{
+		neurons[i] = new Neuron(i, Neuron::Type::SENSOR);
+	}
+
+	// add output nodes to the network
+	uint32_t outputEnd = NETWORK_NUM_OUT + NETWORK_MAX_NODES;
+	for(uint32_t i = NETWORK_MAX_NODES; i < outputEnd; ++i)
+	{
+		neurons[i] = new Neuron(i, Neuron::Type::OUTPUT);
+	}
+
+	// create connections and hidden nodes
+	uint32_t genomeSize = genome.getGenomeLength();
+	for(uint32_t i = 0; i < genomeSize; ++i)
+	{
+		// skip this gene if it is disabled (not in phenotype)
+		const Gene& gene = genome[i];
+		if(!gene.isDisabled())
+		{
+			uint32_t targetID = gene.getTarget();
+			uint32_t sourceID = gene.getSource();
+
+			// create nodes for the current connection gene if they don't already exist
+			//		we know that these ones are HIDDEN -- the sensors and output are already created
+			Neuron*& source = neurons[sourceID];
+			if(source == nullptr)
+			{
+				source = new Neuron(sourceID, Neuron::Type::HIDDEN);
+			}
+			Neuron*& target = neurons[targetID];
+			if(target == nullptr)
+			{
+				target = new Neuron(targetID, Neuron::Type::HIDDEN);
+			}
+
+			// target node's inputs map the connection source to the connection weight
+			target->addInput(*source, gene.getWeight());
+
+			// keep connections by ID for now -- they become slots once the neurons are flattened
+			mConnections.push_back(Connection{ sourceID, targetID, gene.getWeight() });
+		}
+	}
+
+	// flatten into evaluation order and hand out value slots
+	mNeurons.reserve(neurons.size());
+	for(auto& neuron : neurons)
+	{
+		neuron.second->setIndex(static_cast<uint32_t>(mNeurons.size()));
+		mNeurons.push_back(neuron.second);
+	}
+
+	for(uint32_t i = 0; i < NETWORK_NUM_OUT; ++i)
+	{
+		mOutputIndices[i] = neurons[i + NETWORK_MAX_NODES]->getIndex();
+	}
+
+	for(Connection& connection : mConnections)
+	{
+		connection.source = neurons[connection.source]->getIndex();
+		connection.target = neurons[connection.target]->getIndex();
+	}
+}
+
+//-------------------------------------------------------------
+
+NetworkTopology::~NetworkTopology()
+{
+	for(Neuron* neuron : mNeurons)
+	{
+		delete neuron;
+	}
+	mNeurons.clear();
+}
+
+//-------------------------------------------------------------
+
+void NetworkTopology::evaluate(const float* inputs, float* values, float* outputs) const
+{
+	assert(inputs != nullptr);
+	assert(values != nullptr);
+	assert(outputs != nullptr);
+
+	// set the input values on sensor neurons -- sensors always occupy the first slots
+	for(uint32_t i = 0; i < mNumInputs; ++i)
+	{
+		values[i] = inputs[i];
+	}
+
+	// calc output for each neuron in the network
+	for(Neuron* neuron : mNeurons)
+	{
+		neuron->calculateOutput(values);
+	}
+
+	// set the outputs using the values on output neurons
+	for(uint32_t i = 0; i < NETWORK_NUM_OUT; ++i)
+	{
+		outputs[i] = values[mOutputIndices[i]];
+	}
+}
+
+//-------------------------------------------------------------
+
+const vector<Neuron*>& NetworkTopology::getNeurons() const
+{
+	return mNeurons;
+}
+
+//-------------------------------------------------------------
+
+const vector<NetworkTopology::Connection>& NetworkTopology::getConnections() const
+{
+	return mConnections;
+}
+
+//-------------------------------------------------------------
+
+uint32_t NetworkTopology::getNumNeurons() const
+{
+	return static_cast<uint32_t>(mNeurons.size());
+}
+
+//-------------------------------------------------------------
+
+uint32_t NetworkTopology::getNumInputs() const
+{
+	return mNumInputs;
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "Genome.h"
+#include "Neuron.h"
+
+namespace Ecosim
+{
+	/**	The compiled, read-only form of a Genome's
+	 *	phenotype: its Neurons in evaluation order and
+	 *	the weighted connections between them.
+	 *
+	 *	A NetworkTopology holds no activation state, so
+	 *	one instance is shared by every NeuralNetwork
+	 *	built from an identical Genome. The GenomeCache
+	 *	hands these out.
+	 */
+	class NetworkTopology final
+	{
+	public:
+
+		/**	One weighted connection between two Neurons,
+		 *	identified by their slots.
+		 */
+		struct Connection
+		{
+			std::uint32_t source;
+			std::uint32_t target;
+			float weight;
+		};
+
+		NetworkTopology(const NetworkTopology& other) = delete;
+		NetworkTopology& operator=(const NetworkTopology& other) = delete;
+		NetworkTopology(NetworkTopology&& other) = delete;
+		NetworkTopology& operator=(NetworkTopology&& other) = delete;
+
+		/**	@brief Constructor. Creates the Neurons and
+		 *		   connections described by a Genome.
+		 *
+		 *	@param genome The Genome to compile.
+		 *	@param numInputs The number of sensor Neurons.
+		 */
+		NetworkTopology(const Genome& genome, std::uint32_t numInputs);
+
+		/**	@brief Destructor.
+		 */
+		~NetworkTopology();
+
+		/**	@brief Calculates the network outputs by evaluating
+		 *		   all Neurons in the network.
+		 *
+		 *	@param inputs The values fed to the sensor Neurons.
+		 *	@param values The output value of every Neuron, indexed
+		 *				  by Neuron slot. Persists between calls.
+		 *	@param outputs The values retrieved from the output Neurons.
+		 */
+		void evaluate(const float* inputs, float* values, float* outputs) const;
+
+		/**	@brief Gets the Neurons in evaluation order. A
+		 *		   Neuron's position in this list is its slot.
+		 *
+		 *	@return Returns mNeurons.
+		 */
+		const std::vector<Neuron*>& getNeurons() const;
+
+		/**	@brief Gets the enabled connections in the order
+		 *		   their genes appear in the Genome.
+		 *
+		 *	@return Returns mConnections.
+		 */
+		const std::vector<Connection>& getConnections() const;
+
+		/**	@brief Gets the number of Neurons in the network.
+		 *
+		 *	@return Returns the length of mNeurons.
+		 */
+		std::uint32_t getNumNeurons() const;
+
+		/**	@brief Gets the number of sensor Neurons.
+		 *
+		 *	@return Returns mNumInputs.
+		 */
+		std::uint32_t getNumInputs() const;
+
+	private:
+
+		std::vector<Neuron*> mNeurons;
+		std::vector<Connection> mConnections;
+		std::uint32_t mOutputIndices[NETWORK_NUM_OUT];
+		std::uint32_t mNumInputs;
+	};
+}
@@ -1,16 +1,20 @@
-
 #pragma once
 
 #include "ISimComponent.h"
 
 #include "Genome.h"
-#include "Neuron.h"
+#include "NetworkTopology.h"
 
 namespace Ecosim
 {
 	/** Manages an ordered map of interconnected
 	 *	Neurons that produce outputs that affect
 	 *	Agent steering behaviors.
+	 *
+	 *	The Neurons themselves live in a NetworkTopology
+	 *	shared with every other network built from an
+	 *	identical Genome. Each NeuralNetwork only owns
+	 *	its Neurons' output values.
 	 */
 	class NeuralNetwork final : public ISimComponent
 	{
@@ -34,12 +38,15 @@ namespace Ecosim
 
 		/**	@brief Creates a network topology using the Neuron
 		 *		   connections described in a given Genome.
+		 *		   Reuses a cached topology if one was already
+		 *		   compiled for an identical Genome.
 		 *
 		 *	@param genome The Agent's Genome.
 		 */
 		void createNetwork(const Genome& genome);
 
-		/**	@brief Destroys all Neurons in the network.
+		/**	@brief Releases the network topology and clears
+		 *		   all Neuron values.
 		 */
 		void clearNetwork();
 
@@ -51,11 +58,20 @@ namespace Ecosim
 		 */
 		void evaluate(const float* inputs, float* outputs);
 
-		/**	@brief Renders each Neuron and connections between them.
+		/**	@brief Gets the network topology, shared with
+		 *		   every network built from an identical Genome.
+		 *
+		 *	@return Returns mTopology. Null if no network
+		 *			has been created.
+		 */
+		const std::shared_ptr<const NetworkTopology>& getTopology() const;
+
+		/**	@brief Gets the output value of every Neuron,
+		 *		   indexed by Neuron slot.
 		 *
-		 *	@param renderer The simulation rendering object.
+		 *	@return Returns mValues.
 		 */
-		virtual void render(Renderer& renderer) override;
+		const std::vector<float>& getValues() const;
 
 		/**	@brief Gets the number of sensor Neurons.
 		 *
@@ -65,7 +81,8 @@ namespace Ecosim
 
 	private:
 
-		std::map<std::uint32_t, Neuron*> mNeurons;
+		std::shared_ptr<const NetworkTopology> mTopology;
+		std::vector<float> mValues;
 		std::uint32_t mNumInputs;
 	};
 }
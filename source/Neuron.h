@@ -1,8 +1,6 @@
 
 #pragma once
 
-#include "ISimComponent.h"
-
 namespace Ecosim
 {
 	/**	A single "cell" in an Agent's NeuralNetwork.
@@ -15,8 +13,13 @@ namespace Ecosim
 	 *	way, a Neruon can't have redundant connections.
 	 *	The output of each input is multiplied by the
 	 *	weigth of that connection.
+	 *
+	 *	Neurons only describe the network. They are
+	 *	shared between every NeuralNetwork compiled from
+	 *	an identical Genome, so output values live in a
+	 *	per-network array indexed by the Neuron's slot.
 	 */
-	class Neuron final : public ISimComponent
+	class Neuron final
 	{
 	public:
 
@@ -47,51 +50,36 @@ namespace Ecosim
 
 		/**	@brief Calculates the output of this Neuron based
 		 *		   on the connected inputs, the connection
-		 *		   weights, and a sigmoid function. Sets
-		 *		   mValue.
-		 */
-		void calculateOutput();
-
-		/**	@brief Renders this Neuron and all connections to
-		 *		   its input Neurons. The color of the Neuron
-		 *		   is based on its output value. The color of
-		 *		   the connections is based on the weights.
+		 *		   weights, and a sigmoid function.
 		 *
-		 *	@param renderer The simulation rendering object.
+		 *	@param values The output values of the network,
+		 *				  indexed by Neuron slot. The value in
+		 *				  this Neuron's slot is overwritten.
 		 */
-		void render(Renderer& renderer) override;
+		void calculateOutput(float* values) const;
 
-		/**	@brief Adds an input connection to this Neuron.
+		/**	@brief Adds an input connection to this Neuron,
+		 *		   or reweights it if the Neuron already
+		 *		   has one from the same node.
 		 *
 		 *	@param node The input Neuron.
 		 *	@param weight The weight of the connection.
 		 */
 		void addInput(Neuron& node, float weight);
 
-		/** @brief Adjusts the position of this Neuron
-		 *		   for rendering.
-		 *
-		 *	@param other A Neuron connected to us.
-		 */
-		void setPosition(Neuron& other);
-
-		/**	@brief Gets this Neuron's position.
-		 *
-		 *	@return Returns mPosition.
-		 */
-		const glm::vec3& getPosition() const;
-
-		/** @brief Force-sets this Neuron's output value.
+		/**	@brief Sets the slot of this Neuron's output
+		 *		   in its network's value array.
 		 *
-		 *	@param val The new output value.
+		 *	@param index The new slot.
 		 */
-		void setOutput(float val);
+		void setIndex(std::uint32_t index);
 
-		/**	@brief Gets this Neuron's output value.
+		/**	@brief Gets the slot of this Neuron's output
+		 *		   in its network's value array.
 		 *
-		 *	@return Returns mValue.
+		 *	@return Returns mIndex.
 		 */
-		float getOutput() const;
+		std::uint32_t getIndex() const;
 
 		/**	@brief Gets this Neuron's ID.
 		 *
@@ -107,21 +95,11 @@ namespace Ecosim
 
 	private:
 
-		std::unordered_map<Neuron*, float> mInputs;
+		// kept in the order they were added, so sums round the same way every run
+		std::vector<std::pair<Neuron*, float>> mInputs;
 
-		glm::vec3 mPosition;
 		std::uint32_t mID;
+		std::uint32_t mIndex;
 		Type mType;
-
-		float mValue;
-
-
-		struct NeuronPositionData
-		{
-			glm::vec3 origin;
-			std::uint32_t firstID;
-		};
-
-		static std::map<Type, NeuronPositionData> sPositionData;
 	};
 }
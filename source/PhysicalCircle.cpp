@@ -2,22 +2,24 @@
 #include "pch.h"
 #include "PhysicalCircle.h"
 
+#include "World.h"
+
 using namespace Ecosim;
 using namespace std;
 using namespace glm;
 
 RTTI_DEFINITIONS(PhysicalCircle)
 
-map<uint64_t, vector<PhysicalCircle*>> PhysicalCircle::sCollisionObjectLists;
-
-vec2 PhysicalCircle::sBounds;
-float PhysicalCircle::sMaxDistance;
-
 PhysicalCircle::PhysicalCircle(float radius, const vec3& pos, bool isCollisionActive) :
 	SimObject(pos),
+	mRegistryType(UINT32_MAX),
+	mRegistryIndex(0),
+	mTileIndex(UINT32_MAX),
+	mTileSlot(0),
 	mRadius(radius),
 	mIsCollisionActive(isCollisionActive)
 {
+	mHandle = World::current().getObjectRegistry().insert(this);
 	registerObj(*this);
 }
 
@@ -25,7 +27,10 @@ PhysicalCircle::PhysicalCircle(float radius, const vec3& pos, bool isCollisionAc
 
 PhysicalCircle::~PhysicalCircle()
 {
-	unregisterObj(*this);
+	World& world = World::current();
+	world.getCollisionRegistry().remove(*this);
+	world.getTileGrid().remove(*this);
+	world.getObjectRegistry().erase(mHandle);
 }
 
 //-------------------------------------------------------------
@@ -72,44 +77,79 @@ bool PhysicalCircle::isCollisionActive() const
 
 //-------------------------------------------------------------
 
-void PhysicalCircle::registerObj(PhysicalCircle& obj)
+SlotHandle PhysicalCircle::getHandle() const
 {
-	sCollisionObjectLists[obj.instanceTypeID()].push_back(&obj);
+	return mHandle;
 }
 
 //-------------------------------------------------------------
 
-void PhysicalCircle::unregisterObj(PhysicalCircle& obj)
+PhysicalCircle* PhysicalCircle::find(SlotHandle handle)
 {
-	vector<PhysicalCircle*>& list = sCollisionObjectLists[obj.instanceTypeID()];
-	list.erase(remove(list.begin(), list.end(), &obj), list.end());
+	PhysicalCircle** obj = World::current().getObjectRegistry().find(handle);
+	return obj != nullptr ? *obj : nullptr;
+}
+
+//-------------------------------------------------------------
+
+void PhysicalCircle::registerObj(PhysicalCircle& obj)
+{
+	World::current().getCollisionRegistry().add(obj);
 }
 
 //-------------------------------------------------------------
 
 void PhysicalCircle::setBounds(const vec2& bounds)
 {
-	sBounds = bounds;
-	sMaxDistance = glm::sqrt((sBounds.x * sBounds.x) + (sBounds.y * sBounds.y));
+	World::current().setBounds(bounds);
 }
 
 //-------------------------------------------------------------
 
-const vector<PhysicalCircle*>& PhysicalCircle::getCollisionObjList(uint64_t typeID)
+const CollisionRegistry::Lists& PhysicalCircle::getCollisionObjLists(uint64_t typeID)
 {
-	return sCollisionObjectLists[typeID];
+	return World::current().getCollisionRegistry().getLists(typeID);
 }
 
 //-------------------------------------------------------------
 
 const vec2& PhysicalCircle::getBounds()
 {
-	return sBounds;
+	return World::current().getBounds();
+}
+
+//-------------------------------------------------------------
+
+void PhysicalCircle::updateSpatialIndex()
+{
+	// every object derives from the base type, so its lists hold them all
+	World& world = World::current();
+	world.getSpatialIndex().build(world.getCollisionRegistry().getLists(PhysicalCircle::classTypeID()));
+	world.updateFarFields();
+}
+
+//-------------------------------------------------------------
+
+void PhysicalCircle::findContacts(vector<Contact>& results)
+{
+	// far fields only feed perception, so moves since the last tick don't concern them
+	World& world = World::current();
+	SpatialGrid& spatialIndex = world.getSpatialIndex();
+	spatialIndex.build(world.getCollisionRegistry().getLists(PhysicalCircle::classTypeID()));
+	spatialIndex.findContacts(results);
+	SpatialGrid::sortContacts(results);
+}
+
+//-------------------------------------------------------------
+
+const SpatialGrid& PhysicalCircle::getSpatialIndex()
+{
+	return World::current().getSpatialIndex();
 }
 
 //-------------------------------------------------------------
 
 float PhysicalCircle::getMaxDistance()
 {
-	return sMaxDistance;
+	return World::current().getMaxDistance();
 }
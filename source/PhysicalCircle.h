@@ -2,6 +2,9 @@
 #pragma once
 
 #include "SimObject.h"
+#include "CollisionRegistry.h"
+#include "SlotMap.h"
+#include "SpatialGrid.h"
 
 namespace Ecosim
 {
@@ -9,14 +12,30 @@ namespace Ecosim
 	 *	things that derive from PhysicalCircle.
 	 *
 	 *	PhysicalCircles have access to other objects
-	 *	through lists that are mapped to different
-	 *	type IDs.
+	 *	through the World's CollisionRegistry, which
+	 *	answers with every object of a type or any
+	 *	type derived from it.
 	 *
-	 *	On creation, PhysicalCircles should register 
-	 *	themselves with their lists. They unregister
-	 *	themselves on destruction. PhysicalCircles
-	 *	may be kept in multiple lists, because they
-	 *	are registered along their inheritance chain.
+	 *	Each constructor along the inheritance chain
+	 *	registers the object, which moves it into the
+	 *	list for the type built so far, so a finished
+	 *	object is kept in one list only. The base
+	 *	destructor unregisters it.
+	 *
+	 *	Objects with active collision are also bucketed
+	 *	into a shared SpatialGrid, rebuilt once per tick,
+	 *	for queries over a region of the world.
+	 *
+	 *	Every PhysicalCircle also takes a generational
+	 *	handle from its World's object registry. Anything
+	 *	that refers to an object beyond the current call,
+	 *	like an Event waiting in the queue, holds the
+	 *	handle rather than a pointer, and finds nothing
+	 *	once the object is gone.
+	 *
+	 *	The lists, the grid, the registry, and the bounds
+	 *	belong to the World that is current when an object
+	 *	is created.
 	 */
 	class PhysicalCircle abstract : public SimObject
 	{
@@ -77,60 +96,103 @@ namespace Ecosim
 		 */
 		bool isCollisionActive() const;
 
+		/**	@brief Gets this object's handle in the World's
+		 *		   object registry.
+		 *
+		 *	@return Returns mHandle.
+		 */
+		SlotHandle getHandle() const;
+
+		/**	@brief Finds a registered object by its handle.
+		 *
+		 *	@param handle The handle of the object.
+		 *
+		 *	@return Returns the object, or nullptr if it has
+		 *			been destroyed.
+		 */
+		static PhysicalCircle* find(SlotHandle handle);
+
 		/**	@brief Sets the physical bounds and maximum distance
-		 *		   between PhysicalCircles.
+		 *		   between PhysicalCircles. Resizes the spatial
+		 *		   index to match.
 		 *
 		 *	@param bounds The new bounds.
 		 */
 		static void setBounds(const glm::vec2& bounds);
 
-		/**	@brief Retrieves the list of PhysicalCircle objects
-		 *		   registered with a given type ID.
+		/**	@brief Retrieves the lists of PhysicalCircle objects
+		 *		   that are, or derive from, a given type.
 		 *
 		 *	@param typeID The typeID for PhysicalCircles we are requesting.
 		 *
-		 *	@return Returns a reference to the list of PhysicalCircles with
-		 *			the given type ID.
+		 *	@return Returns a reference to the lists. Each object
+		 *			appears in exactly one of them.
 		 */
-		static const std::vector<PhysicalCircle*>& getCollisionObjList(std::uint64_t typeID);
+		static const CollisionRegistry::Lists& getCollisionObjLists(std::uint64_t typeID);
 
 		/**	@brief Gets the physical bounds for PhysicalCircles.
 		 *
-		 *	@return Returns sBounds.
+		 *	@return Returns the bounds of the current World.
 		 */
 		static const glm::vec2& getBounds();
 
+		/**	@brief Rebuckets every PhysicalCircle with active
+		 *		   collision into the spatial index and any
+		 *		   far-field summaries. Call once objects are
+		 *		   done moving for the tick.
+		 */
+		static void updateSpatialIndex();
+
+		/**	@brief Rebuckets every PhysicalCircle with active
+		 *		   collision into the spatial index where it
+		 *		   stands now, then finds every overlapping pair.
+		 *
+		 *	@param results Cleared, then filled with one
+		 *				   contact per pair, in the order
+		 *				   SpatialGrid::sortContacts gives.
+		 */
+		static void findContacts(std::vector<Contact>& results);
+
+		/**	@brief Gets the spatial index of PhysicalCircles
+		 *		   with active collision.
+		 *
+		 *	@return Returns the spatial index of the current World.
+		 */
+		static const SpatialGrid& getSpatialIndex();
+
 		/**	@brief Gets the maximum distance that can be between
 		 *		   PhysicalCircles.
 		 *
-		 *	@return Returns sMaxDistance.
+		 *	@return Returns the maximum distance in the current World.
 		 */
 		static float getMaxDistance();
 
 	protected:
 
-		/**	@brief Adds an object to the collision list mapped to 
-		 *		   the object's type ID.
+		/**	@brief Files an object under the type it has been
+		 *		   built up to, moving it out of the list for
+		 *		   its parent type.
 		 *
 		 *	@param obj The new object.
 		 */
 		static void registerObj(PhysicalCircle& obj);
 
-		/**	@brief Removes an object from the collision list mapped
-		 *		   to the object's type ID.
-		 *
-		 *	@param obj The removed object.
-		 */
-		static void unregisterObj(PhysicalCircle& obj);
-
 	private:
 
-		float mRadius;
-		bool mIsCollisionActive;
+		friend class CollisionRegistry;
+		friend class TileGrid;
+
+		SlotHandle mHandle;
 
-		static std::map<std::uint64_t, std::vector<PhysicalCircle*>> sCollisionObjectLists;
+		// where the registry keeps this object
+		std::uint32_t mRegistryType;
+		std::uint32_t mRegistryIndex;
 
-		static glm::vec2 sBounds;
-		static float sMaxDistance;
+		// which tile owns this object, if the World is tiled
+		std::uint32_t mTileIndex;
+		std::uint32_t mTileSlot;
+
+		float mRadius;
+		bool mIsCollisionActive;
 	};
 }
@@ -3,8 +3,6 @@
 #include "Predator.h"
 
 #include "Prey.h"
-#include "Resource.h"
-#include "ResourceEffects.h"
 
 using namespace Ecosim;
 using namespace std;
@@ -13,7 +11,7 @@ using namespace glm;
 RTTI_DEFINITIONS(Predator)
 
 Predator::Predator() :
-	Agent(PREDATOR_NUM_INPUTS, PREDATOR_COLOR)
+	Agent(Species::get(Species::PREDATOR))
 {
 	registerObj(*this);
 }
@@ -22,7 +20,6 @@ Predator::Predator() :
 
 Predator::~Predator()
 {
-	unregisterObj(*this);
 }
 
 //-------------------------------------------------------------
@@ -36,21 +33,3 @@ void Predator::handleCollision(PhysicalCircle& other)
 		asPrey->kill();
 	}
 }
-
-//-------------------------------------------------------------
-
-void Predator::updatePerceptionInputs()
-{
-	// we can see water and prey
-	updatePerceptionBlock(Resource<Water>::classTypeID(), 0);
-	updatePerceptionBlock(Prey::classTypeID(), 1);
-}
-
-//-------------------------------------------------------------
-
-void Predator::updateCollisions()
-{
-	// we can collide with water and other agents
-	detectCollisions(Resource<Water>::classTypeID());
-	detectCollisions(Agent::classTypeID());
-}
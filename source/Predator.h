@@ -5,10 +5,9 @@
 
 namespace Ecosim
 {
-	/**	Agent class that can see Resource<Water> and Prey,
-	 *	and can collide with Resource<Water> and Agents.
-	 *
-	 *	Predators automatically have 19 network inputs.
+	/**	Agent class that eats Prey. What Predators
+	 *	see and collide with is listed in their
+	 *	Species entry.
 	 */
 	class Predator final : public Agent
 	{
@@ -35,17 +34,5 @@ namespace Ecosim
 		 *				 colliding.
 		 */
 		virtual void handleCollision(PhysicalCircle& other) override;
-
-	protected:
-
-		/**	@brief Updates perception data for Resource<Water>
-		 *		   and Prey.
-		 */
-		virtual void updatePerceptionInputs() override;
-
-		/**	@brief Detects and handles collisions with 
-		 *		   Resource<Water> and Agent.
-		 */
-		virtual void updateCollisions() override;
 	};
 }
@@ -3,8 +3,6 @@
 #include "Prey.h"
 
 #include "Predator.h"
-#include "Resource.h"
-#include "ResourceEffects.h"
 
 using namespace Ecosim;
 using namespace std;
@@ -13,7 +11,7 @@ using namespace glm;
 RTTI_DEFINITIONS(Prey)
 
 Prey::Prey() :
-	Agent(PREY_NUM_INPUTS, PREY_COLOR)
+	Agent(Species::get(Species::PREY))
 {
 	registerObj(*this);
 }
@@ -22,7 +20,6 @@ Prey::Prey() :
 
 Prey::~Prey()
 {
-	unregisterObj(*this);
 }
 
 //-------------------------------------------------------------
@@ -36,23 +33,3 @@ void Prey::handleCollision(PhysicalCircle& other)
 		kill();
 	}
 }
-
-//-------------------------------------------------------------
-
-void Prey::updatePerceptionInputs()
-{
-	// we can see food, water, and predator
-	updatePerceptionBlock(Resource<Food>::classTypeID(), 0);
-	updatePerceptionBlock(Resource<Water>::classTypeID(), 1);
-	updatePerceptionBlock(Predator::classTypeID(), 2);
-}
-
-//-------------------------------------------------------------
-
-void Prey::updateCollisions()
-{
-	// we can collide with food, water, and other agents
-	detectCollisions(Resource<Water>::classTypeID());
-	detectCollisions(Resource<Food>::classTypeID());
-	detectCollisions(Agent::classTypeID());
-}
@@ -5,12 +5,9 @@
 
 namespace Ecosim
 {
-	/**	Agent class that can see Resource<Food>, 
-	 *	Resource<Water>, and Predators, and can 
-	 *	collide with Resource<Food>, Resource<Water>,
-	 *	and Agents.
-	 *
-	 *	Prey automatically have 27 network inputs.
+	/**	Agent class that is eaten by Predators. What
+	 *	Prey see and collide with is listed in their
+	 *	Species entry.
 	 */
 	class Prey final : public Agent
 	{
@@ -37,17 +34,5 @@ namespace Ecosim
 		 *				 colliding.
 		 */
 		virtual void handleCollision(PhysicalCircle& other) override;
-
-	protected:
-
-		/**	@brief Updates perception data for Resource<Food>, 
-		 *		   Resource<Water>, and Predators.
-		 */
-		virtual void updatePerceptionInputs() override;
-
-		/**	@brief Detects and handles collisions with 
-		 *		   Resource<Food>, Resource<Water>, and Agent.
-		 */
-		virtual void updateCollisions() override;
 	};
 }
@@ -33,6 +33,11 @@ namespace Ecosim
 			return false;
 		}
 
+		virtual void appendTypeIDs(std::vector<std::uint64_t>& outIDs) const
+		{
+			UNREFERENCED_PARAMETER(outIDs);
+		}
+
 		template <typename T>
 		T* as() const
 		{
@@ -82,6 +87,11 @@ namespace Ecosim
 				else                                                                                         \
 					{ return Parent::is(name); }                                                             \
 			}                                                                                                \
+			virtual void appendTypeIDs(std::vector<std::uint64_t>& outIDs) const override                    \
+			{                                                                                                \
+				outIDs.push_back(sRunTimeTypeID);                                                            \
+				Parent::appendTypeIDs(outIDs);                                                               \
+			}                                                                                                \
 			private:                                                                                         \
 				static std::uint64_t sRunTimeTypeID;
 
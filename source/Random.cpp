@@ -1,4 +1,3 @@
-
 #include "pch.h"
 #include "Random.h"
 
@@ -9,35 +8,64 @@ using namespace std::chrono;
 using namespace std;
 using namespace glm;
 
+atomic<uint64_t> Random::sNextThreadStream(0);
+
+thread_local Rng* Random::sCurrent = nullptr;
+thread_local Rng Random::sThreadRng(0, sNextThreadStream++);
+
+Random::Scope::Scope(Rng& rng) :
+	mPrevious(sCurrent)
+{
+	sCurrent = &rng;
+}
+
+//-------------------------------------------------------------
+
+Random::Scope::~Scope()
+{
+	sCurrent = mPrevious;
+}
+
+//=============================================================
+
 void Random::seedRandom()
 {
-	srand(static_cast<uint32_t>(time(nullptr)));
+	seedRandom(static_cast<uint64_t>(time(nullptr)));
 }
 
 //-------------------------------------------------------------
 
-int32_t Random::randomRange(int32_t min, int32_t max)
+void Random::seedRandom(uint64_t seed)
+{
+	sThreadRng.seed(seed);
+}
+
+//-------------------------------------------------------------
+
+uint64_t Random::randomSeed()
 {
-	float r = static_cast<float>(rand());
+	return current().next64();
+}
 
-	r /= static_cast<float>(RAND_MAX);
-	r *= max - min;
-	r += min;
+//-------------------------------------------------------------
 
-	return static_cast<int32_t>(r);
+int32_t Random::randomRange(int32_t min, int32_t max)
+{
+	return current().range(min, max);
 }
 
 //-------------------------------------------------------------
 
 float Random::randomRange(float min, float max)
 {
-	float r = static_cast<float>(rand());
+	return current().range(min, max);
+}
 
-	r /= static_cast<float>(RAND_MAX);
-	r *= max - min;
-	r += min;
+//-------------------------------------------------------------
 
-	return r;
+void Random::fillRange(float* outValues, size_t count, float min, float max)
+{
+	current().fill(outValues, count, min, max);
 }
 
 //-------------------------------------------------------------
@@ -46,3 +74,10 @@ vec3 Random::randomVec(float radius)
 {
 	return vec3(randomRange(-radius, radius), randomRange(-radius, radius), 0);
 }
+
+//-------------------------------------------------------------
+
+Rng& Random::current()
+{
+	return sCurrent != nullptr ? *sCurrent : sThreadRng;
+}
@@ -1,18 +1,69 @@
-
 #pragma once
 
+#include "Rng.h"
+
 namespace Ecosim
 {
 	/**	Static utility class for generating random numbers.
+	 *
+	 *	Draws come from whichever Rng stream is bound to
+	 *	the calling thread. A World binds its own stream
+	 *	whenever it is bound, and Agents bind theirs while
+	 *	breeding, so simulation code stays reproducible
+	 *	from the World's seed no matter how many threads
+	 *	run Worlds. With nothing bound, each thread draws
+	 *	from a stream of its own.
 	 */
 	class Random final
 	{
 	public:
 
-		/**	@brief Seeds the random number generator.
+		/**	Binds an Rng stream to the calling thread for
+		 *	the lifetime of the Scope, then restores
+		 *	whatever stream was bound before.
+		 */
+		class Scope final
+		{
+		public:
+
+			Scope(const Scope& other) = delete;
+			Scope& operator=(const Scope& other) = delete;
+			Scope(Scope&& other) = delete;
+			Scope& operator=(Scope&& other) = delete;
+
+			/**	@brief Constructor. Binds a stream.
+			 *
+			 *	@param rng The stream to bind.
+			 */
+			explicit Scope(Rng& rng);
+
+			/**	@brief Destructor. Restores the previous stream.
+			 */
+			~Scope();
+
+		private:
+
+			Rng* mPrevious;
+		};
+
+		/**	@brief Seeds the calling thread's own stream
+		 *		   from the clock.
 		 */
 		static void seedRandom();
 
+		/**	@brief Seeds the calling thread's own stream
+		 *		   with a known value, so a run can be repeated.
+		 *
+		 *	@param seed The seed.
+		 */
+		static void seedRandom(std::uint64_t seed);
+
+		/**	@brief Creates a seed for a new stream.
+		 *
+		 *	@return Returns 64 random bits.
+		 */
+		static std::uint64_t randomSeed();
+
 		/**	@brief Creates a random signed integer.
 		 *
 		 *	@param min The minimum value in the range, inclusive.
@@ -31,6 +82,15 @@ namespace Ecosim
 		 */
 		static float randomRange(float min, float max);
 
+		/**	@brief Fills an array with random floats.
+		 *
+		 *	@param outValues The array to fill.
+		 *	@param count The number of values to draw.
+		 *	@param min The minimum value in the range, inclusive.
+		 *	@param max The maximum value in the range, exclusive.
+		 */
+		static void fillRange(float* outValues, std::size_t count, float min, float max);
+
 		/**	@brief Creates a random xyz point within a radius.
 		 *
 		 *	@param radius The radius of the sphere within which
@@ -42,6 +102,16 @@ namespace Ecosim
 
 	private:
 
-		//
+		/**	@brief Gets the stream bound to the calling thread.
+		 *
+		 *	@return Returns the bound stream, or the thread's
+		 *			own stream if none is bound.
+		 */
+		static Rng& current();
+
+
+		static thread_local Rng* sCurrent;
+		static thread_local Rng sThreadRng;
+		static std::atomic<std::uint64_t> sNextThreadStream;
 	};
 }
@@ -8,23 +8,144 @@ using namespace glm;
 
 const float DEG_TO_RAD = PI / 180.0f;
 
-Renderer* Renderer::sInstance = nullptr;
-
-Renderer* Renderer::instance()
+// circles are fans of a unit circle -- the center, then points around the rim, closing back on the first
+//		a full-detail fan is followed by a coarse one for circles that are small on screen
+const uint32_t CIRCLE_NUM_SEGMENTS = 12;
+const uint32_t CIRCLE_NUM_VERTICES = CIRCLE_NUM_SEGMENTS + 2;
+const uint32_t CIRCLE_NUM_SEGMENTS_LOW = 6;
+const uint32_t CIRCLE_NUM_VERTICES_LOW = CIRCLE_NUM_SEGMENTS_LOW + 2;
+
+// screen radii, in pixels, below which circles drop to the coarse fan, then to points
+const float LOD_RADIUS_LOW = 4.0f;
+const float LOD_RADIUS_POINT = 1.0f;
+const float LOD_POINT_SIZE = 2.0f;
+
+// attribute slots bound in the circle shader
+const GLuint ATTRIB_CORNER = 0;
+const GLuint ATTRIB_INSTANCE = 1;
+const GLuint ATTRIB_COLOR = 2;
+
+const char* CIRCLE_VERTEX_SHADER =
+	"#version 120\n"
+	"attribute vec2 aCorner;\n"
+	"attribute vec3 aInstance;\n"
+	"attribute vec3 aColor;\n"
+	"varying vec3 vColor;\n"
+	"void main()\n"
+	"{\n"
+	"	vColor = aColor;\n"
+	"	gl_Position = gl_ModelViewProjectionMatrix * vec4(aInstance.xy + aCorner * aInstance.z, 0.0, 1.0);\n"
+	"}\n";
+
+const char* CIRCLE_FRAGMENT_SHADER =
+	"#version 120\n"
+	"varying vec3 vColor;\n"
+	"void main()\n"
+	"{\n"
+	"	gl_FragColor = vec4(vColor, 1.0);\n"
+	"}\n";
+
+// OpenGL 1.1 headers stop short of buffers, shaders, and instancing -- those are loaded at runtime
+#ifdef _WIN32
+#define GL_ENTRY __stdcall
+#else
+#define GL_ENTRY
+#endif
+
+const GLenum GL_ARRAY_BUFFER_ = 0x8892;
+const GLenum GL_STATIC_DRAW_ = 0x88E4;
+const GLenum GL_STREAM_DRAW_ = 0x88E0;
+const GLenum GL_FRAGMENT_SHADER_ = 0x8B30;
+const GLenum GL_VERTEX_SHADER_ = 0x8B31;
+const GLenum GL_COMPILE_STATUS_ = 0x8B81;
+const GLenum GL_LINK_STATUS_ = 0x8B82;
+
+namespace
 {
-	if(sInstance == nullptr)
+	struct InstancingFuncs
+	{
+		void (GL_ENTRY* genBuffers)(GLsizei, GLuint*);
+		void (GL_ENTRY* deleteBuffers)(GLsizei, const GLuint*);
+		void (GL_ENTRY* bindBuffer)(GLenum, GLuint);
+		void (GL_ENTRY* bufferData)(GLenum, ptrdiff_t, const void*, GLenum);
+		GLuint (GL_ENTRY* createShader)(GLenum);
+		void (GL_ENTRY* deleteShader)(GLuint);
+		void (GL_ENTRY* shaderSource)(GLuint, GLsizei, const char* const*, const GLint*);
+		void (GL_ENTRY* compileShader)(GLuint);
+		void (GL_ENTRY* getShaderiv)(GLuint, GLenum, GLint*);
+		GLuint (GL_ENTRY* createProgram)();
+		void (GL_ENTRY* deleteProgram)(GLuint);
+		void (GL_ENTRY* attachShader)(GLuint, GLuint);
+		void (GL_ENTRY* bindAttribLocation)(GLuint, GLuint, const char*);
+		void (GL_ENTRY* linkProgram)(GLuint);
+		void (GL_ENTRY* getProgramiv)(GLuint, GLenum, GLint*);
+		void (GL_ENTRY* useProgram)(GLuint);
+		void (GL_ENTRY* enableVertexAttribArray)(GLuint);
+		void (GL_ENTRY* disableVertexAttribArray)(GLuint);
+		void (GL_ENTRY* vertexAttribPointer)(GLuint, GLint, GLenum, GLboolean, GLsizei, const void*);
+		void (GL_ENTRY* vertexAttribDivisor)(GLuint, GLuint);
+		void (GL_ENTRY* drawArraysInstanced)(GLenum, GLint, GLsizei, GLsizei);
+	};
+
+	InstancingFuncs sGL;
+
+	/**	@brief Looks up an OpenGL entry point by name.
+	 *
+	 *	@param func The function pointer to fill.
+	 *	@param name The OpenGL function name.
+	 *
+	 *	@return Returns true if the entry point was found.
+	 */
+	template <typename Func>
+	bool loadFunc(Func& func, const char* name)
 	{
-		sInstance = new Renderer();
+		func = reinterpret_cast<Func>(glfwGetProcAddress(name));
+		return func != nullptr;
 	}
-	return sInstance;
-}
 
-//-------------------------------------------------------------
+	/**	@brief Compiles one shader stage.
+	 *
+	 *	@param type The shader stage.
+	 *	@param source The GLSL source.
+	 *
+	 *	@return Returns the shader, or 0 if it failed to compile.
+	 */
+	GLuint compileShader(GLenum type, const char* source)
+	{
+		GLuint shader = sGL.createShader(type);
+		sGL.shaderSource(shader, 1, &source, nullptr);
+		sGL.compileShader(shader);
+
+		GLint status = GL_FALSE;
+		sGL.getShaderiv(shader, GL_COMPILE_STATUS_, &status);
+		if(status == GL_FALSE)
+		{
+			sGL.deleteShader(shader);
+			shader = 0;
+		}
+		return shader;
+	}
+}
 
 Renderer::Renderer() :
+	mConfig(nullptr),
 	mWindow(nullptr),
-	mOrthoBounds(0.0f, 0.0f)
+	mOrthoBounds(0.0f, 0.0f),
+	mCircleProgram(0),
+	mUnitCircleBuffer(0),
+	mInstanceBuffer(0),
+	mUsesInstancing(false)
 {
+	// center first, then the rim -- full detail, then coarse
+	for(uint32_t numSegments : { CIRCLE_NUM_SEGMENTS, CIRCLE_NUM_SEGMENTS_LOW })
+	{
+		mUnitCircle.push_back(vec2(0.0f, 0.0f));
+		for(uint32_t i = 0; i <= numSegments; ++i)
+		{
+			float radians = i * (360.0f / numSegments) * DEG_TO_RAD;
+			mUnitCircle.push_back(vec2(cos(radians), sin(radians)));
+		}
+	}
 }
 
 //-------------------------------------------------------------
@@ -44,6 +165,10 @@ bool Renderer::init()
 
 			glfwMakeContextCurrent(mWindow);
 			glfwSetWindowShouldClose(mWindow, GLFW_FALSE);
+			glfwSetWindowUserPointer(mWindow, this);
+
+			// present at display rate rather than spinning
+			glfwSwapInterval(1);
 
 			// enforce default window and viewport size
 			resizeWindow(mWindow, mConfig->width, mConfig->height);
@@ -52,6 +177,14 @@ bool Renderer::init()
 			// setting glfw window callbacks
 			glfwSetWindowSizeCallback(mWindow, Renderer::resizeWindow);
 			glfwSetFramebufferSizeCallback(mWindow, Renderer::resizeGL);
+			glfwSetKeyCallback(mWindow, Renderer::receiveKeyboardInput);
+
+			// fall back to expanding circles on the CPU if the driver can't instance
+			mUsesInstancing = initInstancing();
+			if(!mUsesInstancing)
+			{
+				cout << "Renderer -- instancing unavailable, drawing circles as triangles" << endl;
+			}
 
 			result = true;
 		}
@@ -66,6 +199,7 @@ void Renderer::shutdown()
 {
 	if(mWindow)
 	{
+		shutdownInstancing();
 		glfwDestroyWindow(mWindow);
 	}
 	glfwTerminate();
@@ -90,128 +224,353 @@ void Renderer::endFrame()
 
 //-------------------------------------------------------------
 
-void Renderer::drawColoredQuad(const vec3& origin, const vec2& size, const vec3& color)
+void Renderer::submit(const DrawList& drawList)
 {
-	glBegin(GL_QUADS);
+	const ViewBounds& view = drawList.getView();
+	const vector<DrawList::Layer>& layers = drawList.getLayers();
+	const vector<CircleInstance>& circles = drawList.getCircles();
+	const vector<ColoredVertex>& lineVertices = drawList.getLineVertices();
+	const vector<ColoredVertex>& triangleVertices = drawList.getTriangleVertices();
+
+	uint32_t numLayers = static_cast<uint32_t>(layers.size());
+	for(uint32_t i = 0; i < numLayers; ++i)
+	{
+		// each layer runs up to the start of the next, or the end of the buffers
+		const DrawList::Layer& layer = layers[i];
+		uint32_t endCircle = i + 1 < numLayers ? layers[i + 1].firstCircle : static_cast<uint32_t>(circles.size());
+		uint32_t endLineVertex = i + 1 < numLayers ? layers[i + 1].firstLineVertex : static_cast<uint32_t>(lineVertices.size());
+		uint32_t endTriangleVertex = i + 1 < numLayers ? layers[i + 1].firstTriangleVertex : static_cast<uint32_t>(triangleVertices.size());
+
+		// world layers follow the camera, screen layers map straight to window pixels
+		float pixelsPerUnit = 1.0f;
+		if(layer.space == DrawList::Space::WORLD)
+		{
+			setProjection(view.min, view.max);
+			pixelsPerUnit = view.pixelsPerUnit;
+		}
+		else
+		{
+			setProjection(vec2(0.0f, 0.0f), mOrthoBounds);
+		}
 
-	glColor3f(color.r, color.g, color.b);					// top left
-	glVertex3f(origin.x, origin.y, 0);
+		submitVertices(GL_TRIANGLES, triangleVertices.data() + layer.firstTriangleVertex, endTriangleVertex - layer.firstTriangleVertex);
+		submitCircles(circles.data() + layer.firstCircle, endCircle - layer.firstCircle, pixelsPerUnit);
+		submitVertices(GL_LINES, lineVertices.data() + layer.firstLineVertex, endLineVertex - layer.firstLineVertex);
+	}
+}
 
-	glColor3f(color.r, color.g, color.b);					// top right
-	glVertex3f(origin.x + size.x, origin.y, 0);
+//-------------------------------------------------------------
 
-	glColor3f(color.r, color.g, color.b);					// bottom right
-	glVertex3f(origin.x + size.x, origin.y + size.y, 0);
+void Renderer::setKeyPressCallback(KeyPressCallback callback)
+{
+	mKeyPressCallback = std::move(callback);
+}
 
-	glColor3f(color.r, color.g, color.b);					// bottom left
-	glVertex3f(origin.x, origin.y + size.y, 0);
+//-------------------------------------------------------------
 
-	glEnd();
+void Renderer::setConfig(RenderConfig& config)
+{
+	mConfig = &config;
 }
 
 //-------------------------------------------------------------
 
-void Renderer::drawColoredCircle(const vec3& origin, float radius, const vec3& color)
+const vec2& Renderer::getOrthoBounds() const
 {
-	glBegin(GL_TRIANGLE_FAN);
+	return mOrthoBounds;
+}
 
-	glColor3f(color.r, color.g, color.b);
-	glVertex3f(origin.x, origin.y, 0);
+//-------------------------------------------------------------
 
-	float radians = 0.0f;
+void Renderer::flagForClose() const
+{
+	glfwSetWindowShouldClose(mWindow, GLFW_TRUE);
+}
 
-	for(int i = 0; i <= 360; i += 30)
-	{
-		radians = i * DEG_TO_RAD;
-		glVertex2f(origin.x + (cos(radians) * radius), origin.y + (sin(radians) * radius));
-	}
+//-------------------------------------------------------------
 
-	glEnd();
+bool Renderer::isValid() const
+{
+	return !glfwWindowShouldClose(mWindow);
 }
 
 //-------------------------------------------------------------
 
-void Renderer::drawRay(const vec3& origin, const vec3& direction, float length, const vec3& color)
+void Renderer::resizeWindow(GLFWwindow* window, int32_t width, int32_t height)
 {
-	glBegin(GL_LINES);
-
-	glColor3f(color.r, color.g, color.b);
+	glfwSetWindowSize(window, width, height);
+}
 
-	glVertex3f(origin.x, origin.y, 0);
-	glVertex3f(origin.x + direction.x * length, origin.y + direction.y * length, 0);
+//-------------------------------------------------------------
 
-	glEnd();
+void Renderer::setProjection(const vec2& min, const vec2& max)
+{
+	// y runs down the window, like the world
+	glMatrixMode(GL_PROJECTION);
+	glLoadIdentity();
+	glOrtho(min.x, max.x, max.y, min.y, -800.0, 800.0);
+	glMatrixMode(GL_MODELVIEW);
 }
 
 //-------------------------------------------------------------
 
-void Renderer::drawLine(const vec3& point_1, const vec3& point_2, const vec3& color)
+void Renderer::resizeGL(GLFWwindow* window, int32_t width, int32_t height)
 {
-	glBegin(GL_LINES);
+	const Renderer* renderer = static_cast<const Renderer*>(glfwGetWindowUserPointer(window));
 
-	glColor3f(color.r, color.g, color.b);
-
-	glVertex3f(point_1.x, point_1.y, 0);
-	glVertex3f(point_2.x, point_2.y, 0);
+	// resize viewport
+	glViewport(0, 0, (GLsizei)(width), (GLsizei)(height));
+	glMatrixMode(GL_PROJECTION);
+	glLoadIdentity();
 
-	glEnd();
+	// resize ortho camera
+	glOrtho(0, renderer->mOrthoBounds.x, renderer->mOrthoBounds.y, 0, -800.0, 800.0);
+	glMatrixMode(GL_MODELVIEW);
+	glLoadIdentity();
 }
 
 //-------------------------------------------------------------
 
-void Renderer::setKeyInputCallback(GLFWkeyfun callback)
+void Renderer::receiveKeyboardInput(GLFWwindow* window, int32_t key, int32_t scancode, int32_t action, int32_t mods)
 {
-	glfwSetKeyCallback(mWindow, callback);
+	UNREFERENCED_PARAMETER(scancode);
+	UNREFERENCED_PARAMETER(mods);
+
+	Renderer* renderer = static_cast<Renderer*>(glfwGetWindowUserPointer(window));
+	if(action == GLFW_PRESS && renderer->mKeyPressCallback)
+	{
+		renderer->mKeyPressCallback(key);
+	}
 }
 
 //-------------------------------------------------------------
 
-void Renderer::setConfig(RenderConfig& config)
+bool Renderer::initInstancing()
 {
-	mConfig = &config;
+	// instancing needs OpenGL 3.3 entry points
+	bool loaded =
+		loadFunc(sGL.genBuffers, "glGenBuffers") &&
+		loadFunc(sGL.deleteBuffers, "glDeleteBuffers") &&
+		loadFunc(sGL.bindBuffer, "glBindBuffer") &&
+		loadFunc(sGL.bufferData, "glBufferData") &&
+		loadFunc(sGL.createShader, "glCreateShader") &&
+		loadFunc(sGL.deleteShader, "glDeleteShader") &&
+		loadFunc(sGL.shaderSource, "glShaderSource") &&
+		loadFunc(sGL.compileShader, "glCompileShader") &&
+		loadFunc(sGL.getShaderiv, "glGetShaderiv") &&
+		loadFunc(sGL.createProgram, "glCreateProgram") &&
+		loadFunc(sGL.deleteProgram, "glDeleteProgram") &&
+		loadFunc(sGL.attachShader, "glAttachShader") &&
+		loadFunc(sGL.bindAttribLocation, "glBindAttribLocation") &&
+		loadFunc(sGL.linkProgram, "glLinkProgram") &&
+		loadFunc(sGL.getProgramiv, "glGetProgramiv") &&
+		loadFunc(sGL.useProgram, "glUseProgram") &&
+		loadFunc(sGL.enableVertexAttribArray, "glEnableVertexAttribArray") &&
+		loadFunc(sGL.disableVertexAttribArray, "glDisableVertexAttribArray") &&
+		loadFunc(sGL.vertexAttribPointer, "glVertexAttribPointer") &&
+		loadFunc(sGL.vertexAttribDivisor, "glVertexAttribDivisor") &&
+		loadFunc(sGL.drawArraysInstanced, "glDrawArraysInstanced");
+
+	if(!loaded)
+	{
+		return false;
+	}
+
+	// build the circle shader
+	GLuint vertexShader = compileShader(GL_VERTEX_SHADER_, CIRCLE_VERTEX_SHADER);
+	GLuint fragmentShader = compileShader(GL_FRAGMENT_SHADER_, CIRCLE_FRAGMENT_SHADER);
+	if(vertexShader != 0 && fragmentShader != 0)
+	{
+		mCircleProgram = sGL.createProgram();
+		sGL.attachShader(mCircleProgram, vertexShader);
+		sGL.attachShader(mCircleProgram, fragmentShader);
+		sGL.bindAttribLocation(mCircleProgram, ATTRIB_CORNER, "aCorner");
+		sGL.bindAttribLocation(mCircleProgram, ATTRIB_INSTANCE, "aInstance");
+		sGL.bindAttribLocation(mCircleProgram, ATTRIB_COLOR, "aColor");
+		sGL.linkProgram(mCircleProgram);
+
+		GLint status = GL_FALSE;
+		sGL.getProgramiv(mCircleProgram, GL_LINK_STATUS_, &status);
+		if(status == GL_FALSE)
+		{
+			sGL.deleteProgram(mCircleProgram);
+			mCircleProgram = 0;
+		}
+	}
+
+	// the program keeps what it needs
+	if(vertexShader != 0)
+	{
+		sGL.deleteShader(vertexShader);
+	}
+	if(fragmentShader != 0)
+	{
+		sGL.deleteShader(fragmentShader);
+	}
+
+	if(mCircleProgram == 0)
+	{
+		return false;
+	}
+
+	// unit circle never changes -- instance data is refilled every frame
+	sGL.genBuffers(1, &mUnitCircleBuffer);
+	sGL.bindBuffer(GL_ARRAY_BUFFER_, mUnitCircleBuffer);
+	sGL.bufferData(GL_ARRAY_BUFFER_, static_cast<ptrdiff_t>(mUnitCircle.size() * sizeof(vec2)), mUnitCircle.data(), GL_STATIC_DRAW_);
+
+	sGL.genBuffers(1, &mInstanceBuffer);
+	sGL.bindBuffer(GL_ARRAY_BUFFER_, 0);
+
+	return true;
 }
 
 //-------------------------------------------------------------
 
-const vec2& Renderer::getOrthoBounds() const
+void Renderer::shutdownInstancing()
 {
-	return mOrthoBounds;
+	if(mUsesInstancing)
+	{
+		sGL.deleteBuffers(1, &mUnitCircleBuffer);
+		sGL.deleteBuffers(1, &mInstanceBuffer);
+		sGL.deleteProgram(mCircleProgram);
+
+		mUnitCircleBuffer = 0;
+		mInstanceBuffer = 0;
+		mCircleProgram = 0;
+		mUsesInstancing = false;
+	}
 }
 
 //-------------------------------------------------------------
 
-void Renderer::flagForClose() const
+void Renderer::submitCircles(const CircleInstance* circles, uint32_t count, float pixelsPerUnit)
 {
-	glfwSetWindowShouldClose(mWindow, GLFW_TRUE);
+	mCircles.clear();
+	mCoarseCircles.clear();
+	mPointVertices.clear();
+
+	// pick detail by how big each circle is on screen
+	for(uint32_t i = 0; i < count; ++i)
+	{
+		const CircleInstance& circle = circles[i];
+		float screenRadius = circle.radius * pixelsPerUnit;
+
+		if(screenRadius <= LOD_RADIUS_POINT)
+		{
+			mPointVertices.push_back(ColoredVertex{ circle.center, circle.color });
+		}
+		else if(screenRadius <= LOD_RADIUS_LOW)
+		{
+			mCoarseCircles.push_back(circle);
+		}
+		else
+		{
+			mCircles.push_back(circle);
+		}
+	}
+
+	if(mUsesInstancing)
+	{
+		submitInstancedCircles(mCircles.data(), static_cast<uint32_t>(mCircles.size()), 0, CIRCLE_NUM_VERTICES);
+		submitInstancedCircles(mCoarseCircles.data(), static_cast<uint32_t>(mCoarseCircles.size()), CIRCLE_NUM_VERTICES, CIRCLE_NUM_VERTICES_LOW);
+	}
+	else
+	{
+		submitExpandedCircles(mCircles.data(), static_cast<uint32_t>(mCircles.size()), 0, CIRCLE_NUM_VERTICES);
+		submitExpandedCircles(mCoarseCircles.data(), static_cast<uint32_t>(mCoarseCircles.size()), CIRCLE_NUM_VERTICES, CIRCLE_NUM_VERTICES_LOW);
+	}
+
+	glPointSize(LOD_POINT_SIZE);
+	submitVertices(GL_POINTS, mPointVertices.data(), static_cast<uint32_t>(mPointVertices.size()));
 }
 
 //-------------------------------------------------------------
 
-bool Renderer::isValid() const
+void Renderer::submitInstancedCircles(const CircleInstance* circles, uint32_t count, uint32_t firstVertex, uint32_t numVertices)
 {
-	return !glfwWindowShouldClose(mWindow);
+	if(count == 0)
+	{
+		return;
+	}
+
+	const GLsizei stride = sizeof(CircleInstance);
+
+	sGL.useProgram(mCircleProgram);
+
+	// per-vertex corners of the unit circle
+	sGL.bindBuffer(GL_ARRAY_BUFFER_, mUnitCircleBuffer);
+	sGL.enableVertexAttribArray(ATTRIB_CORNER);
+	sGL.vertexAttribPointer(ATTRIB_CORNER, 2, GL_FLOAT, GL_FALSE, sizeof(vec2), nullptr);
+
+	// per-instance center, radius, and color -- orphaned and refilled each frame
+	sGL.bindBuffer(GL_ARRAY_BUFFER_, mInstanceBuffer);
+	sGL.bufferData(GL_ARRAY_BUFFER_, static_cast<ptrdiff_t>(count * sizeof(CircleInstance)), circles, GL_STREAM_DRAW_);
+
+	sGL.enableVertexAttribArray(ATTRIB_INSTANCE);
+	sGL.vertexAttribPointer(ATTRIB_INSTANCE, 3, GL_FLOAT, GL_FALSE, stride, reinterpret_cast<const void*>(offsetof(CircleInstance, center)));
+	sGL.vertexAttribDivisor(ATTRIB_INSTANCE, 1);
+
+	sGL.enableVertexAttribArray(ATTRIB_COLOR);
+	sGL.vertexAttribPointer(ATTRIB_COLOR, 3, GL_FLOAT, GL_FALSE, stride, reinterpret_cast<const void*>(offsetof(CircleInstance, color)));
+	sGL.vertexAttribDivisor(ATTRIB_COLOR, 1);
+
+	sGL.drawArraysInstanced(GL_TRIANGLE_FAN, static_cast<GLint>(firstVertex), static_cast<GLsizei>(numVertices), static_cast<GLsizei>(count));
+
+	// leave fixed-function state as we found it
+	sGL.vertexAttribDivisor(ATTRIB_INSTANCE, 0);
+	sGL.vertexAttribDivisor(ATTRIB_COLOR, 0);
+	sGL.disableVertexAttribArray(ATTRIB_CORNER);
+	sGL.disableVertexAttribArray(ATTRIB_INSTANCE);
+	sGL.disableVertexAttribArray(ATTRIB_COLOR);
+
+	sGL.bindBuffer(GL_ARRAY_BUFFER_, 0);
+	sGL.useProgram(0);
 }
 
 //-------------------------------------------------------------
 
-void Renderer::resizeWindow(GLFWwindow* window, int32_t width, int32_t height)
+void Renderer::submitExpandedCircles(const CircleInstance* circles, uint32_t count, uint32_t firstVertex, uint32_t numVertices)
 {
-	glfwSetWindowSize(window, width, height);
+	// fan's center is its first vertex, so it has two fewer segments than vertices
+	uint32_t numSegments = numVertices - 2;
+
+	mExpandedCircles.clear();
+	mExpandedCircles.reserve(count * numSegments * 3);
+
+	// one triangle per segment of the fan
+	const vec2* fan = mUnitCircle.data() + firstVertex;
+	for(uint32_t c = 0; c < count; ++c)
+	{
+		const CircleInstance& circle = circles[c];
+		for(uint32_t i = 1; i <= numSegments; ++i)
+		{
+			mExpandedCircles.push_back(ColoredVertex{ circle.center, circle.color });
+			mExpandedCircles.push_back(ColoredVertex{ circle.center + fan[i] * circle.radius, circle.color });
+			mExpandedCircles.push_back(ColoredVertex{ circle.center + fan[i + 1] * circle.radius, circle.color });
+		}
+	}
+
+	submitVertices(GL_TRIANGLES, mExpandedCircles.data(), static_cast<uint32_t>(mExpandedCircles.size()));
 }
 
 //-------------------------------------------------------------
 
-void Renderer::resizeGL(GLFWwindow* window, int32_t width, int32_t height)
+void Renderer::submitVertices(GLenum mode, const ColoredVertex* vertices, uint32_t count)
 {
-	UNREFERENCED_PARAMETER(window);
+	if(count == 0)
+	{
+		return;
+	}
 
-	// resize viewport
-	glViewport(0, 0, (GLsizei)(width), (GLsizei)(height));
-	glMatrixMode(GL_PROJECTION);
-	glLoadIdentity();
+	const GLsizei stride = sizeof(ColoredVertex);
 
-	// resize ortho camera
-	glOrtho(0, sInstance->mOrthoBounds.x, sInstance->mOrthoBounds.y, 0, -800.0, 800.0);
-	glMatrixMode(GL_MODELVIEW);
-	glLoadIdentity();
+	glEnableClientState(GL_VERTEX_ARRAY);
+	glEnableClientState(GL_COLOR_ARRAY);
+
+	glVertexPointer(2, GL_FLOAT, stride, &vertices[0].position);
+	glColorPointer(3, GL_FLOAT, stride, &vertices[0].color);
+	glDrawArrays(mode, 0, static_cast<GLsizei>(count));
+
+	glDisableClientState(GL_COLOR_ARRAY);
+	glDisableClientState(GL_VERTEX_ARRAY);
 }
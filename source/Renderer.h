@@ -3,6 +3,8 @@
 
 #include "glfw3.h"
 
+#include "DrawList.h"
+
 namespace Ecosim
 {
 	/**	Collection of data used to initialize
@@ -17,18 +19,31 @@ namespace Ecosim
 
 	//=============================================================
 
-	/**	Singleton rendering class that wraps
-	 *	GLFW and OpenGL calls.
+	/**	Rendering class that wraps GLFW and
+	 *	OpenGL calls. Owns the window, so there
+	 *	is at most one per process.
+	 *
+	 *	Frames are described by a DrawList and
+	 *	submitted with one draw call per primitive
+	 *	type per layer. Circles are drawn as
+	 *	instances of a precomputed unit circle
+	 *	where the driver supports it.
 	 */
 	class Renderer final
 	{
 	public:
 
+		typedef std::function<void(std::int32_t key)> KeyPressCallback;
+
 		Renderer(const Renderer& other) = delete;
 		Renderer& operator=(const Renderer& other) = delete;
 		Renderer(Renderer&& other) = delete;
 		Renderer& operator=(Renderer&& other) = delete;
 
+		/** @brief Constructor.
+		 */
+		Renderer();
+
 		/** @brief Destructor.
 		 */
 		~Renderer() = default;
@@ -48,48 +63,26 @@ namespace Ecosim
 		 */
 		void startFrame();
 
-		/**	@brief Closes OpenGL for the current frame.
+		/**	@brief Closes OpenGL for the current frame and
+		 *		   polls window events.
 		 */
 		void endFrame();
 
-		/**	@brief Draws a solid-color quad.
-		 *
-		 *	@param origin The xyz of the top-left corner of the quad.
-		 *	@param size The x and y dimensions of the quad.
-		 *	@param color The rgb color of the quad.
-		 */
-		void drawColoredQuad(const glm::vec3& origin, const glm::vec2& size, const glm::vec3& color);
-
-		/**	@brief Draws a solid-color circle.
-		 *
-		 *	@param origin The xyz of the center of the circle.
-		 *	@param radius The radius of the circle.
-		 *	@param color The rgb color of the circle.
-		 */
-		void drawColoredCircle(const glm::vec3& origin, float radius, const glm::vec3& color);
-
-		/**	@brief Draws a line in a direction from a point.
+		/**	@brief Draws every primitive in a DrawList, one
+		 *		   layer at a time, through the DrawList's view.
+		 *		   Circles that are small on screen are drawn
+		 *		   with fewer segments, or as points.
 		 *
-		 *	@param origin The xyz of the start of the line.
-		 *	@param direction The xyz direction of the line.
-		 *	@param length The length of the line.
-		 *	@param color The rgb color of the line.
+		 *	@param drawList The primitives to draw.
 		 */
-		void drawRay(const glm::vec3& origin, const glm::vec3& direction, float length, const glm::vec3& color);
+		void submit(const DrawList& drawList);
 
-		/**	@brief Draws a line between two points.
+		/** @brief Registers a function to call whenever a
+		 *		   key is pressed in the window.
 		 *
-		 *	@param point_1 The xyz of the first point of the line.
-		 *	@param point_2 The xyz of the second point of the line.
-		 *	@param color The rgb color of the line.
+		 *	@param callback The function to call with the GLFW key.
 		 */
-		void drawLine(const glm::vec3& point_1, const glm::vec3& point_2, const glm::vec3& color);
-
-		/** @brief Registers a function callback for GLFW inputs.
-		 *
-		 *	@param callback The callback function pointer
-		 */
-		void setKeyInputCallback(GLFWkeyfun callback);
+		void setKeyPressCallback(KeyPressCallback callback);
 
 		/** @brief Sets the configuration variables for the Renderer.
 		 *
@@ -116,20 +109,8 @@ namespace Ecosim
 		 */
 		bool isValid() const;
 
-		/**	@brief Gets the singleton instance of the
-		 *		   Renderer.
-		 *
-		 *	@return Returns a pointer to the Renderer
-		 *			singleton.
-		 */
-		static Renderer* instance();
-
 	private:
 
-		/** @brief Constructor.
-		 */
-		Renderer();
-
 		/**	@brief Static callback for GLFW window resize
 		 *		   events.
 		 *
@@ -148,12 +129,93 @@ namespace Ecosim
 		 */
 		static void resizeGL(GLFWwindow* window, int32_t width, int32_t height);
 
+		/** @brief Static callback for GLFW keyboard events.
+		 *		   Forwards presses to the window's Renderer.
+		 *
+		 *	@param window Handle to the GLFW window.
+		 *	@param key The input key.
+		 *	@param scancode Scancode.
+		 *	@param action The input action.
+		 *	@param mods Secondary keys.
+		 */
+		static void receiveKeyboardInput(GLFWwindow* window, int32_t key, int32_t scancode, int32_t action, int32_t mods);
+
+		/**	@brief Loads the OpenGL entry points used for
+		 *		   instanced circles and creates the shader
+		 *		   and buffers they need.
+		 *
+		 *	@return Returns true if instancing is available.
+		 *			Otherwise, false, and circles are drawn
+		 *			as plain triangles.
+		 */
+		bool initInstancing();
+
+		/**	@brief Deletes the shader and buffers created
+		 *		   for instanced circles.
+		 */
+		void shutdownInstancing();
+
+		/**	@brief Sets an orthographic projection onto a
+		 *		   rectangle.
+		 *
+		 *	@param min The xy of the top-left corner.
+		 *	@param max The xy of the bottom-right corner.
+		 */
+		void setProjection(const glm::vec2& min, const glm::vec2& max);
+
+		/**	@brief Sorts circles by their size on screen and
+		 *		   draws each level of detail with one call.
+		 *
+		 *	@param circles The first circle to draw.
+		 *	@param count The number of circles.
+		 *	@param pixelsPerUnit The current zoom.
+		 */
+		void submitCircles(const CircleInstance* circles, std::uint32_t count, float pixelsPerUnit);
+
+		/**	@brief Draws circles with one instanced draw call.
+		 *
+		 *	@param circles The first circle to draw.
+		 *	@param count The number of circles.
+		 *	@param firstVertex The start of the fan in the unit circle.
+		 *	@param numVertices The number of vertices in the fan.
+		 */
+		void submitInstancedCircles(const CircleInstance* circles, std::uint32_t count, std::uint32_t firstVertex, std::uint32_t numVertices);
+
+		/**	@brief Expands circles into triangles using the
+		 *		   unit circle and draws them with one call.
+		 *
+		 *	@param circles The first circle to draw.
+		 *	@param count The number of circles.
+		 *	@param firstVertex The start of the fan in the unit circle.
+		 *	@param numVertices The number of vertices in the fan.
+		 */
+		void submitExpandedCircles(const CircleInstance* circles, std::uint32_t count, std::uint32_t firstVertex, std::uint32_t numVertices);
+
+		/**	@brief Draws interleaved colored vertices with
+		 *		   one call.
+		 *
+		 *	@param mode The OpenGL primitive mode.
+		 *	@param vertices The first vertex to draw.
+		 *	@param count The number of vertices.
+		 */
+		void submitVertices(GLenum mode, const ColoredVertex* vertices, std::uint32_t count);
+
 
 		RenderConfig* mConfig;
+		KeyPressCallback mKeyPressCallback;
 
 		GLFWwindow* mWindow;
 		glm::vec2 mOrthoBounds;
 
-		static Renderer* sInstance;
+		std::vector<CircleInstance> mCircles;
+		std::vector<CircleInstance> mCoarseCircles;
+		std::vector<ColoredVertex> mPointVertices;
+		std::vector<ColoredVertex> mExpandedCircles;
+		std::vector<glm::vec2> mUnitCircle;
+
+		GLuint mCircleProgram;
+		GLuint mUnitCircleBuffer;
+		GLuint mInstanceBuffer;
+		bool mUsesInstancing;
 	};
 }
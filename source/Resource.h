@@ -3,6 +3,7 @@
 
 #include "IResource.h"
 #include "Agent.h"
+#include "World.h"
 
 namespace Ecosim
 {
@@ -13,6 +14,10 @@ namespace Ecosim
 	 *	The effect is defined by the template
 	 *	argument, which is assumed to inherit
 	 *	IResourceEffect.
+	 *
+	 *	Color, size, lifetime, and yield are shared
+	 *	by every Resource of a type in a World, and
+	 *	are looked up once when the object is created.
 	 */
 	template <typename T>
 	class Resource final : public IResource
@@ -35,29 +40,30 @@ namespace Ecosim
 		virtual ~Resource();
 
 		/**	@brief Initializes the traits that all objects
-		 *		   of this Resource type share.
+		 *		   of this Resource type share in the current
+		 *		   World.
 		 *
 		 *	@param color The color of this Resource type.
 		 *	@param lifetime The maximum age of this Resource type.
 		 *	@param size The collision size of this Resource type.
+		 *	@param yield The strength of this Resource type's effect.
 		 *
 		 *	@note The Resource type must be initialized before
 		 *		  any objects of that type may be created.
 		 */
-		static void init(const glm::vec3& color, float lifetime, float size);
+		static void init(const glm::vec3& color, float lifetime, float size, float yield);
 
-		/** @brief Udpates the age of this object. Deactivates
-		 *		   if the maximum age is exceeded.
+		/**	@brief Gets the maximum age of this Resource type.
 		 *
-		 *	@param clock The simulation's timekeeper.
+		 *	@return Returns the lifetime trait.
 		 */
-		virtual void update(const SimClock& clock) override;
+		virtual float getLifetime() const override;
 
 		/** @brief Renders the Resource.
 		 *
-		 *	@param renderer The simulation rendering object.
+		 *	@param drawList The frame being drawn.
 		 */
-		virtual void render(Renderer& renderer) override;
+		virtual void render(DrawList& drawList) override;
 
 	protected:
 
@@ -69,20 +75,20 @@ namespace Ecosim
 		virtual void handleCollision(PhysicalCircle& other) override;
 
 	private:
+
+		/**	@brief Constructor.
+		 *
+		 *	@param traits The traits of this Resource type.
+		 */
+		explicit Resource(const ResourceTraits& traits);
+
 		
 		T mEffect;
 
-		static glm::vec3 sColor;
-		static float sSize;
-
-		static float sLifetime;
+		const ResourceTraits& mTraits;
 	};
 
 	template <typename T> RTTI_DEFINITIONS(Resource<T>)
 
-	template <typename T> glm::vec3 Resource<T>::sColor = vec3(1.0f, 1.0f, 1.0f);
-	template <typename T> float Resource<T>::sLifetime = 10.0f;
-	template <typename T> float Resource<T>::sSize = 10.0f;
-
-#include "resource.inl"
+#include "Resource.inl"
 }
@@ -1,7 +1,16 @@
 
 template <typename T>
 Resource<T>::Resource() :
-	IResource(sSize)
+	Resource(World::current().getResourceTraits(classTypeID()))
+{
+}
+
+//-------------------------------------------------------------
+
+template <typename T>
+Resource<T>::Resource(const ResourceTraits& traits) :
+	IResource(traits.size),
+	mTraits(traits)
 {
 	registerObj(*this);
 }
@@ -11,42 +20,32 @@ Resource<T>::Resource() :
 template <typename T>
 Resource<T>::~Resource()
 {
-	unregisterObj(*this);
 }
 
 //-------------------------------------------------------------
 
 template <typename T>
-void Resource<T>::init(const glm::vec3& color, float lifetime, float size)
+void Resource<T>::init(const glm::vec3& color, float lifetime, float size, float yield)
 {
-	sLifetime = lifetime;
-	sColor = color;
-	sSize = size;
+	World::current().setResourceTraits(classTypeID(), ResourceTraits{ color, lifetime, size, yield });
 }
 
 //-------------------------------------------------------------
 
 template <typename T>
-void Resource<T>::update(const SimClock& clock)
+float Resource<T>::getLifetime() const
 {
-	if(mIsActive)
-	{
-		mTimeActive += clock.getDeltaTimeScaled();
-		if(mTimeActive >= sLifetime)
-		{
-			deactivate();
-		}
-	}
+	return mTraits.lifetime;
 }
 
 //-------------------------------------------------------------
 
 template <typename T>
-void Resource<T>::render(Renderer& renderer)
+void Resource<T>::render(DrawList& drawList)
 {
 	if(mIsActive)
 	{
-		renderer.drawColoredCircle(mPosition, sSize, sColor);
+		drawList.drawColoredCircle(mPosition, mTraits.size, mTraits.color);
 	}
 }
 
@@ -57,7 +56,7 @@ void Resource<T>::handleCollision(PhysicalCircle& other)
 {
 	if(Agent* agent = other.as<Agent>())
 	{
-		mEffect.applyEffect(*agent);
+		mEffect.applyEffect(*agent, mTraits.yield);
 		deactivate();
 	}
 }
@@ -1,4 +1,3 @@
-
 #include "pch.h"
 #include "ResourceEffects.h"
 
@@ -9,45 +8,14 @@ using namespace glm;
 RTTI_DEFINITIONS(Food)
 RTTI_DEFINITIONS(Water)
 
-float Food::sHungerYield = 0.0f;
-float Water::sThirstYield = 0.0f;
-
-void Food::applyEffect(Agent& agent)
-{
-	agent.updateHunger(sHungerYield);
-}
-
-//-------------------------------------------------------------
-
-void Food::setYields(float hunger)
-{
-	sHungerYield = hunger;
-}
-
-//-------------------------------------------------------------
-
-float Food::getHungerYield()
+void Food::applyEffect(Agent& agent, float yield)
 {
-	return sHungerYield;
+	agent.updateHunger(yield);
 }
 
 //=============================================================
 
-void Water::applyEffect(Agent& agent)
-{
-	agent.updateThirst(sThirstYield);
-}
-
-//-------------------------------------------------------------
-
-void Water::setYields(float thirst)
-{
-	sThirstYield = thirst;
-}
-
-//-------------------------------------------------------------
-
-float Water::getThirstYield()
+void Water::applyEffect(Agent& agent, float yield)
 {
-	return sThirstYield;
+	agent.updateThirst(yield);
 }
@@ -30,24 +30,9 @@ namespace Ecosim
 		/**	@brief Applies a modifier to the Agent's hunger.
 		 *
 		 *	@param agent The colliding Agent.
+		 *	@param yield The change to hunger.
 		 */
-		virtual void applyEffect(Agent& agent) override;
-
-		/**	@brief Sets the effect's hunger yield.
-		 *
-		 *	@param hunger The new effect yield.
-		 */
-		static void setYields(float hunger);
-
-		/**	@brief Gets the effect yield.
-		 *
-		 *	@return hunger Returns sHungerYield
-		 */
-		static float getHungerYield();
-
-	private:
-
-		static float sHungerYield;
+		virtual void applyEffect(Agent& agent, float yield) override;
 	};
 
 	//=============================================================
@@ -77,23 +62,8 @@ namespace Ecosim
 		/**	@brief Applies a modifier to the Agent's thirst.
 		 *
 		 *	@param agent The colliding Agent.
+		 *	@param yield The change to thirst.
 		 */
-		virtual void applyEffect(Agent& agent) override;
-
-		/**	@brief Sets the effect's thirst yield.
-		 *
-		 *	@param thirst The new effect yield.
-		 */
-		static void setYields(float thirst);
-
-		/**	@brief Gets the effect yield.
-		 *
-		 *	@return hunger Returns sThirstYield
-		 */
-		static float getThirstYield();
-
-	private:
-
-		static float sThirstYield;
+		virtual void applyEffect(Agent& agent, float yield) override;
 	};
 }
@@ -0,0 +1,112 @@
+#include "pch.h"
+#include "ResourcePool.h"
+
+using namespace Ecosim;
+using namespace std;
+using namespace glm;
+
+ResourcePool::ResourcePool(uint32_t typeOrdinal, CreateFunc createFunc) :
+	mCreateFunc(createFunc),
+	mTypeOrdinal(typeOrdinal),
+	mNumActive(0)
+{
+}
+
+//-------------------------------------------------------------
+
+ResourcePool::~ResourcePool()
+{
+	clear();
+}
+
+//-------------------------------------------------------------
+
+void ResourcePool::reserve(uint32_t size)
+{
+	mResources.reserve(size);
+	while(mResources.size() < size)
+	{
+		IResource* resource = mCreateFunc();
+		resource->setPoolSlot(mTypeOrdinal, static_cast<uint32_t>(mResources.size()));
+		mResources.push_back(resource);
+	}
+}
+
+//-------------------------------------------------------------
+
+IResource& ResourcePool::spawn()
+{
+	// no inactive resources left -- grow the pool
+	if(mNumActive == mResources.size())
+	{
+		reserve(mNumActive + 1);
+	}
+
+	// first inactive resource is right after the active range
+	IResource& resource = *mResources[mNumActive];
+	++mNumActive;
+
+	resource.activate();
+	return resource;
+}
+
+//-------------------------------------------------------------
+
+void ResourcePool::release(IResource& resource)
+{
+	assert(resource.getTypeOrdinal() == mTypeOrdinal);
+
+	// ignore resources that are already in the inactive range
+	uint32_t index = resource.getPoolIndex();
+	if(index < mNumActive)
+	{
+		--mNumActive;
+		swapSlots(index, mNumActive);
+	}
+}
+
+//-------------------------------------------------------------
+
+void ResourcePool::clear()
+{
+	for(IResource* resource : mResources)
+	{
+		delete resource;
+	}
+	mResources.clear();
+	mNumActive = 0;
+}
+
+//-------------------------------------------------------------
+
+IResource& ResourcePool::operator[](uint32_t index) const
+{
+	assert(index < mNumActive);
+	return *mResources[index];
+}
+
+//-------------------------------------------------------------
+
+uint32_t ResourcePool::numActive() const
+{
+	return mNumActive;
+}
+
+//-------------------------------------------------------------
+
+uint32_t ResourcePool::size() const
+{
+	return static_cast<uint32_t>(mResources.size());
+}
+
+//-------------------------------------------------------------
+
+void ResourcePool::swapSlots(uint32_t first, uint32_t second)
+{
+	if(first != second)
+	{
+		std::swap(mResources[first], mResources[second]);
+		mResources[first]->setPoolSlot(mTypeOrdinal, first);
+		mResources[second]->setPoolSlot(mTypeOrdinal, second);
+	}
+}
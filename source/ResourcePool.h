@@ -0,0 +1,104 @@
+#pragma once
+
+#include "IResource.h"
+
+namespace Ecosim
+{
+	/**	Dense pool of Resources of a single type.
+	 *
+	 *	Active Resources are packed at the front of one
+	 *	array and inactive Resources follow them. Every
+	 *	Resource stores its own slot, so activating and
+	 *	releasing a Resource are both a single swap.
+	 */
+	class ResourcePool final
+	{
+	public:
+
+		typedef std::function<IResource*()> CreateFunc;
+
+		ResourcePool(const ResourcePool& other) = delete;
+		ResourcePool& operator=(const ResourcePool& other) = delete;
+		ResourcePool(ResourcePool&& other) = delete;
+		ResourcePool& operator=(ResourcePool&& other) = delete;
+
+		/**	@brief Constructor.
+		 *
+		 *	@param typeOrdinal The small index of this pool's
+		 *					   Resource type. Stamped on every
+		 *					   Resource the pool creates.
+		 *	@param createFunc Creates a new Resource of this
+		 *					  pool's type.
+		 */
+		ResourcePool(std::uint32_t typeOrdinal, CreateFunc createFunc);
+
+		/**	@brief Destructor. Deletes all Resources.
+		 */
+		~ResourcePool();
+
+		/**	@brief Creates inactive Resources until the pool
+		 *		   holds at least the given number.
+		 *
+		 *	@param size The number of Resources to hold.
+		 */
+		void reserve(std::uint32_t size);
+
+		/**	@brief Moves an inactive Resource to the active
+		 *		   range and activates it. Creates a new
+		 *		   Resource if none are inactive.
+		 *
+		 *	@return Returns the activated Resource.
+		 */
+		IResource& spawn();
+
+		/**	@brief Moves an active Resource to the inactive
+		 *		   range by swapping it with the last active
+		 *		   Resource.
+		 *
+		 *	@param resource The deactivated Resource.
+		 */
+		void release(IResource& resource);
+
+		/**	@brief Deletes all Resources in the pool.
+		 */
+		void clear();
+
+		/**	@brief Gets an active Resource.
+		 *
+		 *	@param index The offset into the active range.
+		 *
+		 *	@return Returns the Resource at the given offset.
+		 *
+		 *	@note The index must be less than numActive().
+		 */
+		IResource& operator[](std::uint32_t index) const;
+
+		/**	@brief Gets the number of active Resources.
+		 *
+		 *	@return Returns mNumActive.
+		 */
+		std::uint32_t numActive() const;
+
+		/**	@brief Gets the number of Resources in the pool.
+		 *
+		 *	@return Returns the length of mResources.
+		 */
+		std::uint32_t size() const;
+
+	private:
+
+		/**	@brief Swaps two Resources and their slots.
+		 *
+		 *	@param first The first slot.
+		 *	@param second The second slot.
+		 */
+		void swapSlots(std::uint32_t first, std::uint32_t second);
+
+
+		std::vector<IResource*> mResources;
+		CreateFunc mCreateFunc;
+
+		std::uint32_t mTypeOrdinal;
+		std::uint32_t mNumActive;
+	};
+}
@@ -0,0 +1,125 @@
+#include "pch.h"
+#include "Rng.h"
+
+using namespace Ecosim;
+using namespace std;
+using namespace glm;
+
+// 2^-24 -- turns the top 24 bits of a draw into a float in [0, 1)
+const float FLOAT_UNIT = 1.0f / 16777216.0f;
+
+const uint64_t GOLDEN_GAMMA = 0x9E3779B97F4A7C15ull;
+
+namespace
+{
+	/**	SplitMix64 finalizer. Scrambles a key so that
+	 *	nearby seeds and stream IDs give unrelated states.
+	 */
+	uint64_t mix(uint64_t value)
+	{
+		value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+		value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+		return value ^ (value >> 31);
+	}
+
+	uint32_t rotl(uint32_t value, int32_t shift)
+	{
+		return (value << shift) | (value >> (32 - shift));
+	}
+}
+
+//-------------------------------------------------------------
+
+Rng::Rng()
+{
+	seed(0);
+}
+
+//-------------------------------------------------------------
+
+Rng::Rng(uint64_t seed, uint64_t stream)
+{
+	this->seed(seed, stream);
+}
+
+//-------------------------------------------------------------
+
+void Rng::seed(uint64_t seed, uint64_t stream)
+{
+	mKey = mix(mix(seed) + (stream + 1) * GOLDEN_GAMMA);
+
+	// fill the state from a SplitMix64 sequence on the key
+	uint64_t low = mix(mKey + GOLDEN_GAMMA);
+	uint64_t high = mix(mKey + GOLDEN_GAMMA * 2);
+	mState[0] = static_cast<uint32_t>(low);
+	mState[1] = static_cast<uint32_t>(low >> 32);
+	mState[2] = static_cast<uint32_t>(high);
+	mState[3] = static_cast<uint32_t>(high >> 32);
+
+	// the all-zero state never leaves zero
+	if((mState[0] | mState[1] | mState[2] | mState[3]) == 0)
+	{
+		mState[0] = 1;
+	}
+}
+
+//-------------------------------------------------------------
+
+Rng Rng::split(uint64_t stream) const
+{
+	return Rng(mKey, stream);
+}
+
+//-------------------------------------------------------------
+
+uint32_t Rng::next()
+{
+	uint32_t result = rotl(mState[1] * 5, 7) * 9;
+	uint32_t t = mState[1] << 9;
+
+	mState[2] ^= mState[0];
+	mState[3] ^= mState[1];
+	mState[1] ^= mState[2];
+	mState[0] ^= mState[3];
+	mState[2] ^= t;
+	mState[3] = rotl(mState[3], 11);
+
+	return result;
+}
+
+//-------------------------------------------------------------
+
+uint64_t Rng::next64()
+{
+	uint64_t high = next();
+	return (high << 32) | next();
+}
+
+//-------------------------------------------------------------
+
+int32_t Rng::range(int32_t min, int32_t max)
+{
+	// scale 32 bits onto the span -- no modulo, no float
+	uint32_t span = static_cast<uint32_t>(max - min);
+	uint64_t scaled = static_cast<uint64_t>(next()) * span;
+	return min + static_cast<int32_t>(scaled >> 32);
+}
+
+//-------------------------------------------------------------
+
+float Rng::range(float min, float max)
+{
+	float unit = static_cast<float>(next() >> 8) * FLOAT_UNIT;
+	return min + unit * (max - min);
+}
+
+//-------------------------------------------------------------
+
+void Rng::fill(float* outValues, size_t count, float min, float max)
+{
+	float span = max - min;
+	for(size_t i = 0; i < count; ++i)
+	{
+		outValues[i] = min + static_cast<float>(next() >> 8) * FLOAT_UNIT * span;
+	}
+}
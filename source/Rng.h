@@ -0,0 +1,98 @@
+#pragma once
+
+namespace Ecosim
+{
+	/**	Seedable, splittable pseudorandom number stream
+	 *	(xoshiro128**).
+	 *
+	 *	A stream is keyed by a seed and a stream ID, and
+	 *	split() derives a child stream from the key alone,
+	 *	without drawing from the parent. So a World can
+	 *	hand each Agent its own stream by index, and what
+	 *	any one stream produces never depends on how many
+	 *	draws other streams made first or which thread
+	 *	made them.
+	 *
+	 *	Streams are small values and may be copied; a
+	 *	copy continues the same sequence.
+	 */
+	class Rng final
+	{
+	public:
+
+		/**	@brief Constructor. Keys the stream with seed 0.
+		 */
+		Rng();
+
+		/**	@brief Constructor.
+		 *
+		 *	@param seed The seed.
+		 *	@param stream The ID of the stream within the seed.
+		 */
+		explicit Rng(std::uint64_t seed, std::uint64_t stream = 0);
+
+		/**	@brief Restarts the stream with a new key.
+		 *
+		 *	@param seed The seed.
+		 *	@param stream The ID of the stream within the seed.
+		 */
+		void seed(std::uint64_t seed, std::uint64_t stream = 0);
+
+		/**	@brief Derives an independent child stream.
+		 *		   Does not advance this stream.
+		 *
+		 *	@param stream The ID of the child.
+		 *
+		 *	@return Returns the child stream.
+		 */
+		Rng split(std::uint64_t stream) const;
+
+		/**	@brief Draws 32 random bits.
+		 *
+		 *	@return Returns the next value in the stream.
+		 */
+		std::uint32_t next();
+
+		/**	@brief Draws 64 random bits.
+		 *
+		 *	@return Returns the next two values in the stream,
+		 *			high word first.
+		 */
+		std::uint64_t next64();
+
+		/**	@brief Creates a random signed integer without
+		 *		   going through floating point.
+		 *
+		 *	@param min The minimum value in the range, inclusive.
+		 *	@param max The maximum value in the range, exclusive.
+		 *
+		 *	@return Returns a random integer in the range [min, max)
+		 */
+		std::int32_t range(std::int32_t min, std::int32_t max);
+
+		/**	@brief Creates a random float.
+		 *
+		 *	@param min The minimum value in the range, inclusive.
+		 *	@param max The maximum value in the range, exclusive.
+		 *
+		 *	@return Returns a random float in the range [min, max)
+		 */
+		float range(float min, float max);
+
+		/**	@brief Fills an array with random floats. Draws
+		 *		   the same values as calling range() once per
+		 *		   element.
+		 *
+		 *	@param outValues The array to fill.
+		 *	@param count The number of values to draw.
+		 *	@param min The minimum value in the range, inclusive.
+		 *	@param max The maximum value in the range, exclusive.
+		 */
+		void fill(float* outValues, std::size_t count, float min, float max);
+
+	private:
+
+		std::uint32_t mState[4];
+		std::uint64_t mKey;
+	};
+}
@@ -0,0 +1,148 @@
+#include "pch.h"
+#include "Scenario.h"
+
+using namespace Ecosim;
+using namespace std;
+using namespace glm;
+
+bool Scenario::readFromFile(const string& filename, WorldConfig& outConfig)
+{
+	ifstream scenarioFile;
+	scenarioFile.open(filename, ifstream::in);
+	if(!scenarioFile.is_open())
+	{
+		cout << "Scenario -- cannot open " << filename << endl;
+		return false;
+	}
+
+	bool isValid = readFromStream(scenarioFile, outConfig);
+	scenarioFile.close();
+
+	return isValid;
+}
+
+//-------------------------------------------------------------
+
+bool Scenario::readFromStream(istream& stream, WorldConfig& outConfig)
+{
+	WorldConfig config = outConfig;
+	config.species.clear();
+	config.savesGenomes = false;
+
+	string line;
+	while(getline(stream, line))
+	{
+		istringstream lineStream(line);
+
+		string key;
+		if(!(lineStream >> key) || key[0] == '#')
+		{
+			continue;
+		}
+
+		bool isValid = true;
+		if(key == "bounds")
+		{
+			isValid = static_cast<bool>(lineStream >> config.bounds.x >> config.bounds.y) &&
+				config.bounds.x > 0.0f && config.bounds.y > 0.0f;
+		}
+		else if(key == "seed")
+		{
+			isValid = static_cast<bool>(lineStream >> config.seed);
+		}
+		else if(key == "resources")
+		{
+			isValid = static_cast<bool>(lineStream >> config.numResources);
+		}
+		else if(key == "tiles")
+		{
+			isValid = static_cast<bool>(lineStream >> config.numTiles);
+		}
+		else if(key == "param")
+		{
+			string name;
+			float value;
+			SimParams::Field field = nullptr;
+			if(lineStream >> name >> value)
+			{
+				field = SimParams::findField(name);
+			}
+
+			isValid = field != nullptr;
+			if(isValid)
+			{
+				config.params.*field = value;
+			}
+		}
+		else if(key == "species")
+		{
+			config.species.emplace_back();
+			isValid = readSpecies(lineStream, config.species.back());
+		}
+		else
+		{
+			isValid = false;
+		}
+
+		if(!isValid)
+		{
+			cout << "Scenario -- cannot read line: " << line << endl;
+			return false;
+		}
+	}
+
+	outConfig = config;
+	return true;
+}
+
+//-------------------------------------------------------------
+
+bool Scenario::readSpecies(istream& stream, SpeciesConfig& outSpecies)
+{
+	string kind, source;
+	if(!(stream >> kind >> outSpecies.count >> source) || (kind != "prey" && kind != "predator"))
+	{
+		return false;
+	}
+
+	outSpecies.isPrey = kind == "prey";
+
+	if(source == "random")
+	{
+		// weight range and size are optional
+		if(stream >> outSpecies.weightRange)
+		{
+			stream >> outSpecies.sizeGene;
+		}
+		return outSpecies.weightRange >= 0.0f && outSpecies.sizeGene > 0.0f;
+	}
+
+	if(source == "genome")
+	{
+		string filename;
+		if(!(stream >> filename))
+		{
+			return false;
+		}
+
+		ifstream genomeFile;
+		genomeFile.open(filename, ifstream::in);
+		if(!genomeFile.is_open())
+		{
+			cout << "Scenario -- cannot open " << filename << endl;
+			return false;
+		}
+
+		// keep the text -- each World parses its own template
+		stringstream genomeText;
+		genomeText << genomeFile.rdbuf();
+		outSpecies.genome = genomeText.str();
+		genomeFile.close();
+
+		// the header must agree with the species asked for
+		uint32_t id; bool usesNEAT, isPrey;
+		return static_cast<bool>(genomeText >> id >> usesNEAT >> isPrey) && isPrey == outSpecies.isPrey;
+	}
+
+	return false;
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "World.h"
+
+namespace Ecosim
+{
+	/**	Static utility class for reading scenario files,
+	 *	which describe a World to build: its size, seed,
+	 *	Resources, parameters, and the population of each
+	 *	species.
+	 *
+	 *	A scenario file holds one setting per line; blank
+	 *	lines and lines starting with # are skipped.
+	 *
+	 *		bounds <width> <height>
+	 *		seed <seed>
+	 *		resources <count of each type>
+	 *		tiles <count, 0 for a serial tick>
+	 *		param <name> <value>
+	 *		species <prey|predator> <count> genome <genome file>
+	 *		species <prey|predator> <count> random [weight range] [size]
+	 *
+	 *	Parameter names are the members of SimParams. A
+	 *	species built from a genome file clones and mutates
+	 *	that Genome, which is read once, here; the World
+	 *	builds its Agents in memory. A scenario's population
+	 *	isn't the one in the Genome files, so a scenario
+	 *	World never writes them back.
+	 */
+	class Scenario final
+	{
+	public:
+
+		/**	@brief Reads a scenario file into a World config.
+		 *		   Settings the file doesn't give are left
+		 *		   as they were.
+		 *
+		 *	@param filename The scenario file.
+		 *	@param outConfig Receives the settings.
+		 *
+		 *	@return Returns true if the file was read.
+		 *			Returns false if it, or a genome file it
+		 *			names, is missing, or it holds a setting
+		 *			or parameter we don't know.
+		 */
+		static bool readFromFile(const std::string& filename, WorldConfig& outConfig);
+
+		/**	@brief Reads the settings of a scenario file.
+		 *
+		 *	@param stream The stream holding the scenario.
+		 *	@param outConfig Receives the settings.
+		 *
+		 *	@return Returns true if every line was understood.
+		 */
+		static bool readFromStream(std::istream& stream, WorldConfig& outConfig);
+
+	private:
+
+		/**	@brief Reads one species line, after the word
+		 *		   "species".
+		 *
+		 *	@param stream The rest of the line.
+		 *	@param outSpecies Receives the species.
+		 *
+		 *	@return Returns true if the line was understood.
+		 */
+		static bool readSpecies(std::istream& stream, SpeciesConfig& outSpecies);
+	};
+}
@@ -0,0 +1,106 @@
+#include "pch.h"
+#include "ScentField.h"
+
+using namespace Ecosim;
+using namespace std;
+using namespace glm;
+
+ScentField::ScentField(uint64_t typeID, float cellSize) :
+	mTypeID(typeID),
+	mInvCellSize(1.0f / cellSize),
+	mNumColumns(1),
+	mNumRows(1)
+{
+	assert(cellSize > 0.0f);
+	mValues.assign(1, 0.0f);
+	mScratch.assign(1, 0.0f);
+}
+
+//-------------------------------------------------------------
+
+void ScentField::setBounds(const vec2& bounds)
+{
+	mNumColumns = std::max(1u, static_cast<uint32_t>(ceil(bounds.x * mInvCellSize)));
+	mNumRows = std::max(1u, static_cast<uint32_t>(ceil(bounds.y * mInvCellSize)));
+
+	mValues.assign(mNumColumns * mNumRows, 0.0f);
+	mScratch.assign(mValues.size(), 0.0f);
+}
+
+//-------------------------------------------------------------
+
+void ScentField::deposit(const vec3& pos, float amount)
+{
+	mValues[cellIndex(pos)] += amount;
+}
+
+//-------------------------------------------------------------
+
+void ScentField::diffuse(float spread, float retention)
+{
+	spread = SimMath::clampNum(spread, 0.0f, 0.25f);
+	const float center = 1.0f - 4.0f * spread;
+	const uint32_t lastColumn = mNumColumns - 1;
+
+	for(uint32_t row = 0; row < mNumRows; ++row)
+	{
+		// edge rows and columns stand in for their missing neighbors, so no scent leaks out
+		const float* in = &mValues[row * mNumColumns];
+		const float* up = row > 0 ? in - mNumColumns : in;
+		const float* down = row + 1 < mNumRows ? in + mNumColumns : in;
+		float* out = &mScratch[row * mNumColumns];
+
+		if(mNumColumns == 1)
+		{
+			out[0] = (in[0] * (1.0f - 2.0f * spread) + spread * (up[0] + down[0])) * retention;
+			continue;
+		}
+
+		out[0] = (in[0] * center + spread * (in[0] + in[1] + up[0] + down[0])) * retention;
+
+		// the interior has no branches, so the compiler can vectorize it
+		for(uint32_t column = 1; column < lastColumn; ++column)
+		{
+			out[column] = (in[column] * center + spread * (in[column - 1] + in[column + 1] + up[column] + down[column])) * retention;
+		}
+
+		out[lastColumn] = (in[lastColumn] * center +
+			spread * (in[lastColumn - 1] + in[lastColumn] + up[lastColumn] + down[lastColumn])) * retention;
+	}
+
+	mValues.swap(mScratch);
+}
+
+//-------------------------------------------------------------
+
+float ScentField::sample(const vec3& pos) const
+{
+	return mValues[cellIndex(pos)];
+}
+
+//-------------------------------------------------------------
+
+void ScentField::hashState(StateHash& hash) const
+{
+	// type IDs are addresses, so they'd differ between runs -- the Environment tags fields by index
+	hash.add(mValues.data(), mValues.size());
+}
+
+//-------------------------------------------------------------
+
+uint64_t ScentField::getTypeID() const
+{
+	return mTypeID;
+}
+
+//-------------------------------------------------------------
+
+uint32_t ScentField::cellIndex(const vec3& pos) const
+{
+	float column = pos.x * mInvCellSize;
+	float row = pos.y * mInvCellSize;
+
+	uint32_t x = column <= 0.0f ? 0 : std::min(static_cast<uint32_t>(column), mNumColumns - 1);
+	uint32_t y = row <= 0.0f ? 0 : std::min(static_cast<uint32_t>(row), mNumRows - 1);
+	return y * mNumColumns + x;
+}
@@ -0,0 +1,105 @@
+#pragma once
+
+#include "StateHash.h"
+
+namespace Ecosim
+{
+	/**	Scalar field over the world that objects of
+	 *	one type leave their scent in.
+	 *
+	 *	The field is a uniform grid of concentrations.
+	 *	Each tick, objects deposit into the cell under
+	 *	them, then every cell shares a little with its
+	 *	four neighbors and the whole field decays. The
+	 *	edges let nothing out. Reading the field is a
+	 *	single cell lookup, however many objects left
+	 *	the scent, so Agents can follow it for far less
+	 *	than a scan of every object.
+	 */
+	class ScentField final
+	{
+	public:
+
+		ScentField(const ScentField& other) = delete;
+		ScentField& operator=(const ScentField& other) = delete;
+		ScentField(ScentField&& other) = delete;
+		ScentField& operator=(ScentField&& other) = delete;
+
+		/**	@brief Constructor.
+		 *
+		 *	@param typeID The type ID of the objects whose
+		 *				  scent this is.
+		 *	@param cellSize The width and height of each cell.
+		 */
+		ScentField(std::uint64_t typeID, float cellSize);
+
+		/**	@brief Destructor.
+		 */
+		~ScentField() = default;
+
+		/**	@brief Sizes the field to cover the world.
+		 *		   Clears the field.
+		 *
+		 *	@param bounds The size of the world.
+		 */
+		void setBounds(const glm::vec2& bounds);
+
+		/**	@brief Adds scent to the cell under a point.
+		 *
+		 *	@param pos The point.
+		 *	@param amount The scent to add.
+		 */
+		void deposit(const glm::vec3& pos, float amount);
+
+		/**	@brief Spreads and decays the field by one step.
+		 *
+		 *	@param spread The share each cell passes to each
+		 *				  neighbor. Clamped to 0.25, past
+		 *				  which the stencil is unstable.
+		 *	@param retention The share of the field kept
+		 *					 after decay.
+		 */
+		void diffuse(float spread, float retention);
+
+		/**	@brief Reads the scent at a point. Points outside
+		 *		   the world read the nearest edge cell.
+		 *
+		 *	@param pos The point.
+		 *
+		 *	@return Returns the concentration of its cell.
+		 */
+		float sample(const glm::vec3& pos) const;
+
+		/**	@brief Mixes every cell into a state hash.
+		 *
+		 *	@param hash The hash to mix into.
+		 */
+		void hashState(StateHash& hash) const;
+
+		/**	@brief Gets the type whose scent this is.
+		 *
+		 *	@return Returns mTypeID.
+		 */
+		std::uint64_t getTypeID() const;
+
+	private:
+
+		/**	@brief Gets the index of the cell under a point.
+		 *
+		 *	@param pos The point.
+		 *
+		 *	@return Returns the index into mValues.
+		 */
+		std::uint32_t cellIndex(const glm::vec3& pos) const;
+
+
+		std::vector<float> mValues;
+		std::vector<float> mScratch;
+
+		std::uint64_t mTypeID;
+
+		float mInvCellSize;
+		std::uint32_t mNumColumns;
+		std::uint32_t mNumRows;
+	};
+}
@@ -54,6 +54,15 @@ void SimClock::update()
 
 //-------------------------------------------------------------
 
+void SimClock::step(float deltaSeconds)
+{
+	mDeltaTime = deltaSeconds;
+	mTotalTime += deltaSeconds;
+	mDeltaTimeScaled = mDeltaTime * mTimeScale;
+}
+
+//-------------------------------------------------------------
+
 void SimClock::incrementTimeScale()
 {
 	if(mTimeScale < mMaxTimeScale)
@@ -35,6 +35,13 @@ namespace Ecosim
 		 */
 		void update();
 
+		/**	@brief Advances the clock by a fixed amount without
+		 *		   waiting on real time. Used by headless runs.
+		 *
+		 *	@param deltaSeconds The unscaled duration of the frame.
+		 */
+		void step(float deltaSeconds);
+
 		/** @brief Increases the speed of the clock, up to
 		 *		   the maximum time scale.
 		 */
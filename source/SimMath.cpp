@@ -63,3 +63,41 @@ float SimMath::lerp(float val, float min, float max)
 
 	return (val - min) / (max - min);
 }
+
+//-------------------------------------------------------------
+
+uint64_t SimMath::hashBytes(const void* data, size_t size, uint64_t seed)
+{
+	const uint64_t FNV_PRIME = 1099511628211ULL;
+	const uint8_t* bytes = static_cast<const uint8_t*>(data);
+
+	uint64_t hash = seed;
+	for(size_t i = 0; i < size; ++i)
+	{
+		hash ^= bytes[i];
+		hash *= FNV_PRIME;
+	}
+	return hash;
+}
+
+//-------------------------------------------------------------
+
+uint32_t SimMath::mortonCode(const vec2& point, const vec2& bounds)
+{
+	// spreads the low 16 bits out to every other bit
+	auto spreadBits = [](uint32_t bits)
+	{
+		bits &= 0x0000ffff;
+		bits = (bits | (bits << 8)) & 0x00ff00ff;
+		bits = (bits | (bits << 4)) & 0x0f0f0f0f;
+		bits = (bits | (bits << 2)) & 0x33333333;
+		bits = (bits | (bits << 1)) & 0x55555555;
+		return bits;
+	};
+
+	const float MAX_CELL = 65535.0f;
+	float column = bounds.x > 0.0f ? clampNum(point.x / bounds.x, 0.0f, 1.0f) * MAX_CELL : 0.0f;
+	float row = bounds.y > 0.0f ? clampNum(point.y / bounds.y, 0.0f, 1.0f) * MAX_CELL : 0.0f;
+
+	return spreadBits(static_cast<uint32_t>(column)) | (spreadBits(static_cast<uint32_t>(row)) << 1);
+}
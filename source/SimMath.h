@@ -71,5 +71,32 @@ namespace Ecosim
 		 *		  If 'val' is more than 'max' the function returns 1.
 		 */
 		static float lerp(float val, float min, float max);
+
+		/**	@brief Hashes a block of memory with 64-bit FNV-1a.
+		 *
+		 *	@param data The bytes to hash.
+		 *	@param size The number of bytes to hash.
+		 *	@param seed A running hash to continue from, so several
+		 *				blocks can be folded into one hash.
+		 *
+		 *	@return Returns the hash of the bytes.
+		 */
+		static std::uint64_t hashBytes(const void* data, std::size_t size, std::uint64_t seed = HASH_SEED);
+
+		/**	@brief Gets a point's place along a Z-order
+		 *		   (Morton) curve, which visits the world
+		 *		   in ever smaller quadrants. Points close
+		 *		   on the curve are close in the world.
+		 *
+		 *	@param point The point.
+		 *	@param bounds The size of the world. Points
+		 *				  outside it are clamped to its edges.
+		 *
+		 *	@return Returns the point's 16-bit column and
+		 *			row, bits interleaved.
+		 */
+		static std::uint32_t mortonCode(const glm::vec2& point, const glm::vec2& bounds);
+
+		static const std::uint64_t HASH_SEED = 14695981039346656037ULL;
 	};
 }
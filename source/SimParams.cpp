@@ -0,0 +1,38 @@
+#include "pch.h"
+#include "SimParams.h"
+
+using namespace Ecosim;
+using namespace std;
+using namespace glm;
+
+SimParams::Field SimParams::findField(const string& name)
+{
+	static const unordered_map<string, Field> sFields =
+	{
+		{ "spawnRateFood", &SimParams::spawnRateFood },
+		{ "spawnRateWater", &SimParams::spawnRateWater },
+		{ "yieldFood", &SimParams::yieldFood },
+		{ "yieldWater", &SimParams::yieldWater },
+		{ "scentDeposit", &SimParams::scentDeposit },
+		{ "scentSpread", &SimParams::scentSpread },
+		{ "scentDecay", &SimParams::scentDecay },
+		{ "perceptionTheta", &SimParams::perceptionTheta },
+		{ "agentSortPeriod", &SimParams::agentSortPeriod },
+		{ "thinkIntervalMax", &SimParams::thinkIntervalMax },
+		{ "thinkNearDistance", &SimParams::thinkNearDistance },
+		{ "thinkFastSpeed", &SimParams::thinkFastSpeed },
+		{ "mutateWeightsChance", &SimParams::mutateWeightsChance },
+		{ "mutateAddConnectionChance", &SimParams::mutateAddConnectionChance },
+		{ "mutateAddNeuronChance", &SimParams::mutateAddNeuronChance },
+		{ "mutateDisableChance", &SimParams::mutateDisableChance },
+		{ "mutateEnableChance", &SimParams::mutateEnableChance },
+		{ "fitnessWeightTime", &SimParams::fitnessWeightTime },
+		{ "fitnessWeightHealth", &SimParams::fitnessWeightHealth },
+		{ "fitnessWeightHunger", &SimParams::fitnessWeightHunger },
+		{ "fitnessWeightThirst", &SimParams::fitnessWeightThirst },
+		{ "fitnessWeightEnergy", &SimParams::fitnessWeightEnergy }
+	};
+
+	auto iter = sFields.find(name);
+	return iter != sFields.end() ? iter->second : nullptr;
+}
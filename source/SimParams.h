@@ -0,0 +1,65 @@
+#pragma once
+
+namespace Ecosim
+{
+	/**	Tunable values that shape how a World evolves.
+	 *
+	 *	These used to be compile-time constants. They are
+	 *	carried by each World's config so headless runs
+	 *	can try different values side by side, and each
+	 *	one can be looked up by name for sweeps.
+	 */
+	struct SimParams
+	{
+		// resource spawning and nourishment
+		float spawnRateFood = 3.0f;
+		float spawnRateWater = 3.0f;
+		float yieldFood = 0.2f;
+		float yieldWater = 0.2f;
+
+		// scent left per object per second, share passed to each neighbor per second, share lost per second
+		float scentDeposit = 1.0f;
+		float scentSpread = 2.0f;
+		float scentDecay = 0.5f;
+
+		// 0 sees every object exactly -- above that, distant cells narrower than theta times their distance are seen as one cluster
+		float perceptionTheta = 0.0f;
+
+		// seconds between re-sorting the Agents along a Z-order curve, so neighbors update together -- 0 keeps load order
+		float agentSortPeriod = 2.0f;
+
+		// brain level of detail -- an Agent with nothing to react to runs its network once in this many ticks,
+		// holding its last outputs between. 1 thinks every tick
+		float thinkIntervalMax = 1.0f;
+		// what counts as something to react to: any object this near, or moving faster than this share of
+		// top speed -- 0 turns either check off. An Agent with no energy can't move, so it never needs to
+		float thinkNearDistance = 20.0f;
+		float thinkFastSpeed = 0.9f;
+
+		// chance of each NEAT mutation per reproduction
+		float mutateWeightsChance = 1.0f;
+		float mutateAddConnectionChance = 0.075f;
+		float mutateAddNeuronChance = 0.075f;
+		float mutateDisableChance = 0.02f;
+		float mutateEnableChance = 0.02f;
+
+		// fitness weights
+		float fitnessWeightTime = 0.8f;
+		float fitnessWeightHealth = 0.2f;
+		float fitnessWeightHunger = 0.15f;
+		float fitnessWeightThirst = 0.15f;
+		float fitnessWeightEnergy = 0.7f;
+
+		typedef float SimParams::* Field;
+
+		/**	@brief Finds a parameter by name. Names match
+		 *		   the member names.
+		 *
+		 *	@param name The name of the parameter.
+		 *
+		 *	@return Returns a pointer to the member, or
+		 *			nullptr if there is no such parameter.
+		 */
+		static Field findField(const std::string& name);
+	};
+}
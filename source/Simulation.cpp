@@ -2,11 +2,15 @@
 #include "pch.h"
 #include "Simulation.h"
 
+#include "AgentManager.h"
+
 using namespace Ecosim;
 using namespace std;
 using namespace glm;
 
-Simulation* Simulation::sInstance = nullptr;
+// fraction of the view moved per pan
+const float CAMERA_PAN_STEP = 0.25f;
+
 Simulation::HandlerFuncs Simulation::sInputHandlers = 
 {
 	{ GLFW_KEY_P, &Simulation::togglePaused },					// pause / unpause
@@ -20,23 +24,24 @@ Simulation::HandlerFuncs Simulation::sInputHandlers =
 	{ GLFW_KEY_M, &Simulation::toggleAllowMutation },			// toggle allow agents to mutate
 	{ GLFW_KEY_SPACE, &Simulation::toggleDrawNetwork },			// toggle draw selected agent network
 
-	{ GLFW_KEY_ESCAPE, &Simulation::flagForClose }				// close
-};
+	{ GLFW_KEY_W, &Simulation::panUp },							// move camera
+	{ GLFW_KEY_S, &Simulation::panDown },
+	{ GLFW_KEY_A, &Simulation::panLeft },
+	{ GLFW_KEY_D, &Simulation::panRight },
 
-Simulation* Simulation::instance()
-{
-	if(sInstance == nullptr)
-	{
-		sInstance = new Simulation();
-	}
-	return sInstance;
-}
+	{ GLFW_KEY_EQUAL, &Simulation::zoomIn },					// zoom camera / fit world to window
+	{ GLFW_KEY_MINUS, &Simulation::zoomOut },
+	{ GLFW_KEY_HOME, &Simulation::resetCamera },
 
-//-------------------------------------------------------------
+	{ GLFW_KEY_ESCAPE, &Simulation::flagForClose }				// close
+};
 
 Simulation::Simulation() :
+	mWorld(),
 	mClock(),
-	mEventQueue(nullptr),
+	mCamera(),
+	mIsRunning(false),
+	mConfig(nullptr),
 	mRenderer(nullptr),
 	mIsPaused(false)
 {
@@ -52,10 +57,28 @@ int32_t Simulation::run()
 		return -1;
 	}
 
-	while(mRenderer->isValid())
+	if(mConfig->usesRenderThread)
 	{
-		update();
-		render();
+		// simulation ticks on its own -- this thread just draws whatever it publishes
+		mIsRunning = true;
+		mSimulationThread = thread(&Simulation::runSimulationThread, this);
+
+		while(mRenderer->isValid())
+		{
+			presentSnapshot();
+		}
+
+		mIsRunning = false;
+		mSimulationThread.join();
+	}
+	else
+	{
+		while(mRenderer->isValid())
+		{
+			update();
+			recordSnapshot();
+			presentSnapshot();
+		}
 	}
 
 	shutdown();
@@ -69,29 +92,20 @@ bool Simulation::init()
 {
 	bool result = false;
 
-	// we have a config, and valid event queue and renderer
-	if(mConfig != nullptr && mConfig->eventQueue != nullptr && mConfig->renderer != nullptr)
+	// we have a config and a valid renderer
+	if(mConfig != nullptr && mConfig->renderer != nullptr)
 	{
-		mEventQueue = mConfig->eventQueue;
 		mRenderer = mConfig->renderer;
 
 		if(mRenderer->init())
 		{
 			// misc inits
-			mRenderer->setKeyInputCallback(Simulation::receiveKeyboardInput);
-			PhysicalCircle::setBounds(mRenderer->getOrthoBounds());
-
-			// create components
-			mEnvironment = std::make_shared<Environment>();
-			mAgentManager = std::make_shared<AgentManager>();
-
-			// init components
-			mEnvironment->init();
-			mAgentManager->init();
-
-			// add components to lists
-			mComponents.push_back(mEnvironment);
-			mComponents.push_back(mAgentManager);
+			mRenderer->setKeyPressCallback([this](int32_t key)
+			{
+				receiveKeyPress(key);
+			});
+			mCamera.init(mRenderer->getOrthoBounds(), mConfig->world.bounds);
+			mWorld.init(mConfig->world);
 
 			result = true;
 		}
@@ -104,13 +118,19 @@ bool Simulation::init()
 
 void Simulation::shutdown()
 {
-	for(auto& component : mComponents)
+	mWorld.shutdown();
+	mRenderer->shutdown();
+}
+
+//-------------------------------------------------------------
+
+void Simulation::runSimulationThread()
+{
+	while(mIsRunning)
 	{
-		component->shutdown();
+		update();
+		recordSnapshot();
 	}
-	mComponents.clear();
-
-	mRenderer->shutdown();
 }
 
 //-------------------------------------------------------------
@@ -119,30 +139,55 @@ void Simulation::update()
 {
 	mClock.update();
 
+	runCommands();
+
 	if(!mIsPaused)
 	{
-		for(auto& component : mComponents)
-		{
-			component->update(mClock);
-		}
-
-		// deliver any events that were posted this frame
-		mEventQueue->update();
+		mWorld.update(mClock);
 	}
 }
 
 //-------------------------------------------------------------
 
-void Simulation::render()
+void Simulation::recordSnapshot()
 {
+	DrawList& drawList = mSnapshots.getWriteBuffer();
+	drawList.clear();
+	drawList.setView(mCamera.getView());
+
+	mWorld.render(drawList);
+
+	mSnapshots.publish();
+}
+
+//-------------------------------------------------------------
+
+void Simulation::presentSnapshot()
+{
+	// keep drawing the last snapshot if the simulation hasn't published a new one
+	mSnapshots.acquire();
+
 	mRenderer->startFrame();
+	mRenderer->submit(mSnapshots.getReadBuffer());
+	mRenderer->endFrame();
+}
+
+//-------------------------------------------------------------
 
-	for(auto& component : mComponents)
+void Simulation::runCommands()
+{
+	vector<Command> commands;
 	{
-		component->render(*mRenderer);
+		lock_guard<mutex> lock(mCommandMutex);
+		commands.swap(mCommands);
 	}
 
-	mRenderer->endFrame();
+	// handlers reach into the world's objects
+	World::Scope scope(mWorld);
+	for(Command& command : commands)
+	{
+		command(*this);
+	}
 }
 
 //-------------------------------------------------------------
@@ -170,28 +215,77 @@ void Simulation::decrementTimeScale()
 
 void Simulation::toggleAllowMutation()
 {
-	mAgentManager->toggleAllowMutation();
+	mWorld.getAgentManager().toggleAllowMutation();
 }
 
 //-------------------------------------------------------------
 
 void Simulation::toggleDrawNetwork()
 {
-	mAgentManager->toggleDrawNetwork();
+	mWorld.getAgentManager().toggleDrawNetwork();
 }
 
 //-------------------------------------------------------------
 
 void Simulation::selectNextAgent()
 {
-	mAgentManager->selectNextAgent();
+	mWorld.getAgentManager().selectNextAgent();
 }
 
 //-------------------------------------------------------------
 
 void Simulation::selectPrevAgent()
 {
-	mAgentManager->selectPrevAgent();
+	mWorld.getAgentManager().selectPrevAgent();
+}
+
+//-------------------------------------------------------------
+
+void Simulation::panUp()
+{
+	mCamera.pan(vec2(0.0f, -CAMERA_PAN_STEP));
+}
+
+//-------------------------------------------------------------
+
+void Simulation::panDown()
+{
+	mCamera.pan(vec2(0.0f, CAMERA_PAN_STEP));
+}
+
+//-------------------------------------------------------------
+
+void Simulation::panLeft()
+{
+	mCamera.pan(vec2(-CAMERA_PAN_STEP, 0.0f));
+}
+
+//-------------------------------------------------------------
+
+void Simulation::panRight()
+{
+	mCamera.pan(vec2(CAMERA_PAN_STEP, 0.0f));
+}
+
+//-------------------------------------------------------------
+
+void Simulation::zoomIn()
+{
+	mCamera.zoomIn();
+}
+
+//-------------------------------------------------------------
+
+void Simulation::zoomOut()
+{
+	mCamera.zoomOut();
+}
+
+//-------------------------------------------------------------
+
+void Simulation::resetCamera()
+{
+	mCamera.reset();
 }
 
 //-------------------------------------------------------------
@@ -218,19 +312,14 @@ void Simulation::flagForClose()
 
 //-------------------------------------------------------------
 
-void Simulation::receiveKeyboardInput(GLFWwindow* window, int32_t key, int32_t scancode, int32_t action, int32_t mods)
+void Simulation::receiveKeyPress(int32_t key)
 {
-	UNREFERENCED_PARAMETER(window);
-	UNREFERENCED_PARAMETER(scancode);
-	UNREFERENCED_PARAMETER(mods);
-
-	if(action == GLFW_PRESS)
+	// only care about the key presses for which we have a mapped handler
+	//		handlers run on the simulation thread between ticks
+	HandlerFuncs::iterator iter = sInputHandlers.find(key);
+	if(iter != sInputHandlers.end())
 	{
-		// only care about the key presses for which we have a mapped handler
-		HandlerFuncs::iterator iter = sInputHandlers.find(key);
-		if(iter != sInputHandlers.end())
-		{
-			iter->second(*sInstance);
-		}
+		lock_guard<mutex> lock(mCommandMutex);
+		mCommands.push_back(iter->second);
 	}
 }
@@ -1,10 +1,10 @@
 
 #pragma once
 
-#include "EventQueue.h"
-
-#include "Environment.h"
-#include "AgentManager.h"
+#include "Camera.h"
+#include "Renderer.h"
+#include "TripleBuffer.h"
+#include "World.h"
 
 namespace Ecosim
 {
@@ -13,18 +13,24 @@ namespace Ecosim
 	 */
 	struct SimConfig
 	{
-		EventQueue* eventQueue;
 		Renderer* renderer;
+
+		WorldConfig world;
+		bool usesRenderThread;
 	};
 
 	//=============================================================
 
-	/** Singleton object that manages the program loop.
-	 *	Manages a list of ISimComponent objects that can
-	 *	be updated and rendered.
+	/** Manages the program loop of a windowed World.
+	 *	The World holds everything being simulated; the
+	 *	Simulation adds the clock, camera, and input.
 	 *
-	 *	Also stores pointers to the Renderer and EventQueue
-	 *	singletons.
+	 *	Each tick, components draw into a DrawList that is
+	 *	published through a triple buffer. Optionally, the
+	 *	simulation ticks on its own thread while the main
+	 *	thread presents the latest DrawList at display rate,
+	 *	so drawing never slows the simulation. Keyboard
+	 *	handlers are queued and run between ticks either way.
 	 */
 	class Simulation final
 	{
@@ -35,6 +41,10 @@ namespace Ecosim
 		Simulation(Simulation&& other) = delete;
 		Simulation& operator=(Simulation&& other) = delete;
 
+		/** @brief Constructor.
+		 */
+		Simulation();
+
 		/** @brief Destructor.
 		 */
 		~Simulation() = default;
@@ -53,42 +63,44 @@ namespace Ecosim
 		 */
 		void setConfig(SimConfig& config);
 
-		/**	@brief Gets the singleton instance of the
-		 *		   Simulation.
-		 *
-		 *	@return Returns a pointer to the Simulation
-		 *			singleton.
-		 */
-		static Simulation* instance();
-
 	private:
 
-		/** @brief Constructor.
-		 */
-		Simulation();
-
-		/**	@brief Initializes the Renderer and all
-		 *		   components needed for the simulation.
+		/**	@brief Initializes the Renderer and the World.
 		 *
 		 *	@return Returns true if the initialization was
 		 *			successful. Returns false if the config
-		 *			data, Renderer, or EventQueue is null,
-		 *			or if the Renderer fails initialization.
+		 *			data or Renderer is null, or if the
+		 *			Renderer fails initialization.
 		 */
 		bool init();
 
-		/** @brief Shuts down the Renderer and all components.
+		/** @brief Shuts down the Renderer and the World.
 		 */
 		void shutdown();
 
-		/** @brief Updates components and delivers events
-		 *		   posted this frame.
+		/**	@brief Ticks the simulation until the Renderer
+		 *		   closes. Runs on the simulation thread.
+		 */
+		void runSimulationThread();
+
+		/** @brief Runs queued commands, then updates the
+		 *		   World unless paused.
 		 */
 		void update();
 
-		/**	@brief Renders components.
+		/**	@brief Has the World draw into the next snapshot
+		 *		   and publishes it.
+		 */
+		void recordSnapshot();
+
+		/**	@brief Presents the most recent snapshot.
+		 */
+		void presentSnapshot();
+
+		/**	@brief Runs the commands queued since the
+		 *		   last tick.
 		 */
-		void render();
+		void runCommands();
 
 		/**	@brief Calls on the simulation clock to increment
 		 *		   the time scale.
@@ -119,6 +131,34 @@ namespace Ecosim
 		 */
 		void selectPrevAgent();
 
+		/**	@brief Pans the camera up.
+		 */
+		void panUp();
+
+		/**	@brief Pans the camera down.
+		 */
+		void panDown();
+
+		/**	@brief Pans the camera left.
+		 */
+		void panLeft();
+
+		/**	@brief Pans the camera right.
+		 */
+		void panRight();
+
+		/**	@brief Zooms the camera in.
+		 */
+		void zoomIn();
+
+		/**	@brief Zooms the camera out.
+		 */
+		void zoomOut();
+
+		/**	@brief Fits the whole world in the window.
+		 */
+		void resetCamera();
+
 		/**	@brief Toggles the simulation paused state.
 		 */
 		void togglePaused();
@@ -127,32 +167,34 @@ namespace Ecosim
 		 */
 		void flagForClose();
 
-		/** @brief Static callback for GLFW keyboard events.
+		/** @brief Queues the handler mapped to a key press,
+		 *		   if there is one.
 		 *
-		 *	@param window Handle to the GLFW window.
-		 *	@param key The input key.
-		 *	@param scancode Scancode.
-		 *	@param action The input action.
-		 *	@param mods Secondary keys.
+		 *	@param key The pressed key.
 		 */
-		static void receiveKeyboardInput(GLFWwindow* window, int32_t key, int32_t scancode, int32_t action, int32_t mods);
+		void receiveKeyPress(int32_t key);
 		
 
-		std::vector<std::shared_ptr<ISimComponent>> mComponents;
-		std::shared_ptr<AgentManager> mAgentManager;
-		std::shared_ptr<Environment> mEnvironment;
+		World mWorld;
 
 		SimClock mClock;
+		Camera mCamera;
+
+		TripleBuffer<DrawList> mSnapshots;
+
+		typedef std::function<void(Simulation&)> Command;
+		std::vector<Command> mCommands;
+		std::mutex mCommandMutex;
+
+		std::thread mSimulationThread;
+		std::atomic<bool> mIsRunning;
 
 		SimConfig* mConfig;
-		EventQueue* mEventQueue;
 		Renderer* mRenderer;
 
 		bool mIsPaused;
 
-		typedef std::unordered_map<int32_t, std::function<void(Simulation&)>> HandlerFuncs;
+		typedef std::unordered_map<int32_t, Command> HandlerFuncs;
 		static HandlerFuncs sInputHandlers;
-
-		static Simulation* sInstance;
 	};
 }
@@ -0,0 +1,209 @@
+#pragma once
+
+namespace Ecosim
+{
+	/**	Reference to a value in a SlotMap. A handle
+	 *	outlives its value safely -- once the value is
+	 *	erased, the handle finds nothing, even after the
+	 *	slot is reused.
+	 */
+	struct SlotHandle
+	{
+		std::uint32_t index = UINT32_MAX;
+		std::uint32_t generation = 0;
+
+		/**	@brief Says whether the handle was ever given out.
+		 *
+		 *	@return Returns true for a default handle.
+		 */
+		bool isNull() const;
+
+		/**	@brief Equality operator.
+		 *
+		 *	@param other The handle to compare against.
+		 *
+		 *	@return Returns true if both refer to the same
+		 *			slot and generation.
+		 */
+		bool operator==(const SlotHandle& other) const;
+
+		/**	@brief Inequality operator.
+		 *
+		 *	@param other The handle to compare against.
+		 *
+		 *	@return Returns the opposite of operator==.
+		 */
+		bool operator!=(const SlotHandle& other) const;
+	};
+
+	//=============================================================
+
+	/**	Container that hands out generational handles to
+	 *	the values it holds.
+	 *
+	 *	Values are packed densely, so iterating them walks
+	 *	contiguous memory; erasing moves the last value into
+	 *	the hole. Handles go through a slot array instead,
+	 *	and each slot counts how many times it has been
+	 *	reused. A handle whose generation no longer matches
+	 *	its slot is stale, and finds nothing. Freed slots
+	 *	are reused newest first from a free list threaded
+	 *	through the slot array.
+	 *
+	 *	Handles only depend on the order of inserts and
+	 *	erases, so a seeded World gives out the same ones
+	 *	every run.
+	 */
+	template <typename T>
+	class SlotMap final
+	{
+	public:
+
+		typedef typename std::vector<T>::iterator Iterator;
+		typedef typename std::vector<T>::const_iterator ConstIterator;
+
+		SlotMap(const SlotMap& other) = delete;
+		SlotMap& operator=(const SlotMap& other) = delete;
+		SlotMap(SlotMap&& other) = delete;
+		SlotMap& operator=(SlotMap&& other) = delete;
+
+		/**	@brief Constructor.
+		 */
+		SlotMap();
+
+		/**	@brief Destructor.
+		 */
+		~SlotMap() = default;
+
+		/**	@brief Adds a value, reusing a free slot if
+		 *		   there is one.
+		 *
+		 *	@param value The value to add. Moved.
+		 *
+		 *	@return Returns the handle of the value.
+		 */
+		SlotHandle insert(T value);
+
+		/**	@brief Removes a value. Its handle, and any copy
+		 *		   of it, goes stale.
+		 *
+		 *	@param handle The handle of the value.
+		 *
+		 *	@return Returns false if the handle was already
+		 *			stale.
+		 */
+		bool erase(SlotHandle handle);
+
+		/**	@brief Finds the value a handle refers to.
+		 *
+		 *	@param handle The handle of the value.
+		 *
+		 *	@return Returns the value, or nullptr if the
+		 *			handle is stale. The pointer is only good
+		 *			until the next insert or erase.
+		 */
+		T* find(SlotHandle handle);
+
+		/**	@brief Finds the value a handle refers to.
+		 *
+		 *	@param handle The handle of the value.
+		 *
+		 *	@return Returns the value, or nullptr if the
+		 *			handle is stale. The pointer is only good
+		 *			until the next insert or erase.
+		 */
+		const T* find(SlotHandle handle) const;
+
+		/**	@brief Gets the handle of a value by its place
+		 *		   in the packed storage.
+		 *
+		 *	@param denseIndex The place of the value.
+		 *
+		 *	@return Returns the handle.
+		 */
+		SlotHandle getHandle(std::uint32_t denseIndex) const;
+
+		/**	@brief Removes every value. Every handle given
+		 *		   out goes stale.
+		 */
+		void clear();
+
+		/**	@brief Releases storage left over from values
+		 *		   that have been erased. Slots are kept, so
+		 *		   stale handles stay stale.
+		 */
+		void compact();
+
+		/**	@brief Gets the number of values held.
+		 *
+		 *	@return Returns the size of mValues.
+		 */
+		std::uint32_t size() const;
+
+		/**	@brief Gets the number of slots ever used, live
+		 *		   or free.
+		 *
+		 *	@return Returns the size of mSlots.
+		 */
+		std::uint32_t numSlots() const;
+
+		/**	@brief Gets a value by its place in the packed
+		 *		   storage.
+		 *
+		 *	@param denseIndex The place of the value.
+		 *
+		 *	@return Returns the value.
+		 */
+		T& operator[](std::uint32_t denseIndex);
+
+		/**	@brief Gets a value by its place in the packed
+		 *		   storage.
+		 *
+		 *	@param denseIndex The place of the value.
+		 *
+		 *	@return Returns the value.
+		 */
+		const T& operator[](std::uint32_t denseIndex) const;
+
+		/**	@brief Gets the start of the packed values.
+		 *
+		 *	@return Returns an iterator to the first value.
+		 */
+		Iterator begin();
+
+		/**	@brief Gets the end of the packed values.
+		 *
+		 *	@return Returns an iterator past the last value.
+		 */
+		Iterator end();
+
+		/**	@brief Gets the start of the packed values.
+		 *
+		 *	@return Returns an iterator to the first value.
+		 */
+		ConstIterator begin() const;
+
+		/**	@brief Gets the end of the packed values.
+		 *
+		 *	@return Returns an iterator past the last value.
+		 */
+		ConstIterator end() const;
+
+	private:
+
+		// a live slot points at its value, a free one at the next free slot
+		struct Slot
+		{
+			std::uint32_t generation;
+			std::uint32_t target;
+		};
+
+		std::vector<Slot> mSlots;
+		std::vector<T> mValues;
+		std::vector<std::uint32_t> mValueSlots;
+
+		std::uint32_t mFreeHead;
+	};
+
+#include "SlotMap.inl"
+}
@@ -0,0 +1,205 @@
+
+inline bool SlotHandle::isNull() const
+{
+	return index == UINT32_MAX;
+}
+
+//-------------------------------------------------------------
+
+inline bool SlotHandle::operator==(const SlotHandle& other) const
+{
+	return index == other.index && generation == other.generation;
+}
+
+//-------------------------------------------------------------
+
+inline bool SlotHandle::operator!=(const SlotHandle& other) const
+{
+	return !(*this == other);
+}
+
+//=============================================================
+
+template <typename T>
+SlotMap<T>::SlotMap() :
+	mFreeHead(UINT32_MAX)
+{
+}
+
+//-------------------------------------------------------------
+
+template <typename T>
+SlotHandle SlotMap<T>::insert(T value)
+{
+	std::uint32_t slotIndex = mFreeHead;
+	if(slotIndex != UINT32_MAX)
+	{
+		// reuse the newest free slot -- its generation was bumped when it was freed
+		mFreeHead = mSlots[slotIndex].target;
+	}
+	else
+	{
+		slotIndex = static_cast<std::uint32_t>(mSlots.size());
+		mSlots.push_back(Slot{ 1, 0 });
+	}
+
+	Slot& slot = mSlots[slotIndex];
+	slot.target = static_cast<std::uint32_t>(mValues.size());
+
+	mValues.push_back(std::move(value));
+	mValueSlots.push_back(slotIndex);
+
+	return SlotHandle{ slotIndex, slot.generation };
+}
+
+//-------------------------------------------------------------
+
+template <typename T>
+bool SlotMap<T>::erase(SlotHandle handle)
+{
+	if(find(handle) == nullptr)
+	{
+		return false;
+	}
+
+	Slot& slot = mSlots[handle.index];
+	std::uint32_t hole = slot.target;
+	std::uint32_t last = static_cast<std::uint32_t>(mValues.size() - 1);
+
+	// fill the hole with the last value, and point its slot at the new place
+	if(hole != last)
+	{
+		mValues[hole] = std::move(mValues[last]);
+		mValueSlots[hole] = mValueSlots[last];
+		mSlots[mValueSlots[hole]].target = hole;
+	}
+	mValues.pop_back();
+	mValueSlots.pop_back();
+
+	// stale every handle to the slot, then free it
+	++slot.generation;
+	slot.target = mFreeHead;
+	mFreeHead = handle.index;
+
+	return true;
+}
+
+//-------------------------------------------------------------
+
+template <typename T>
+T* SlotMap<T>::find(SlotHandle handle)
+{
+	if(handle.index >= mSlots.size())
+	{
+		return nullptr;
+	}
+
+	const Slot& slot = mSlots[handle.index];
+	return slot.generation == handle.generation ? &mValues[slot.target] : nullptr;
+}
+
+//-------------------------------------------------------------
+
+template <typename T>
+const T* SlotMap<T>::find(SlotHandle handle) const
+{
+	return const_cast<SlotMap<T>*>(this)->find(handle);
+}
+
+//-------------------------------------------------------------
+
+template <typename T>
+SlotHandle SlotMap<T>::getHandle(std::uint32_t denseIndex) const
+{
+	assert(denseIndex < mValues.size());
+
+	std::uint32_t slotIndex = mValueSlots[denseIndex];
+	return SlotHandle{ slotIndex, mSlots[slotIndex].generation };
+}
+
+//-------------------------------------------------------------
+
+template <typename T>
+void SlotMap<T>::clear()
+{
+	// erase back to front, so nothing has to move
+	while(!mValues.empty())
+	{
+		erase(getHandle(static_cast<std::uint32_t>(mValues.size() - 1)));
+	}
+}
+
+//-------------------------------------------------------------
+
+template <typename T>
+void SlotMap<T>::compact()
+{
+	mValues.shrink_to_fit();
+	mValueSlots.shrink_to_fit();
+}
+
+//-------------------------------------------------------------
+
+template <typename T>
+std::uint32_t SlotMap<T>::size() const
+{
+	return static_cast<std::uint32_t>(mValues.size());
+}
+
+//-------------------------------------------------------------
+
+template <typename T>
+std::uint32_t SlotMap<T>::numSlots() const
+{
+	return static_cast<std::uint32_t>(mSlots.size());
+}
+
+//-------------------------------------------------------------
+
+template <typename T>
+T& SlotMap<T>::operator[](std::uint32_t denseIndex)
+{
+	assert(denseIndex < mValues.size());
+	return mValues[denseIndex];
+}
+
+//-------------------------------------------------------------
+
+template <typename T>
+const T& SlotMap<T>::operator[](std::uint32_t denseIndex) const
+{
+	assert(denseIndex < mValues.size());
+	return mValues[denseIndex];
+}
+
+//-------------------------------------------------------------
+
+template <typename T>
+typename SlotMap<T>::Iterator SlotMap<T>::begin()
+{
+	return mValues.begin();
+}
+
+//-------------------------------------------------------------
+
+template <typename T>
+typename SlotMap<T>::Iterator SlotMap<T>::end()
+{
+	return mValues.end();
+}
+
+//-------------------------------------------------------------
+
+template <typename T>
+typename SlotMap<T>::ConstIterator SlotMap<T>::begin() const
+{
+	return mValues.begin();
+}
+
+//-------------------------------------------------------------
+
+template <typename T>
+typename SlotMap<T>::ConstIterator SlotMap<T>::end() const
+{
+	return mValues.end();
+}
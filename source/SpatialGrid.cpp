@@ -0,0 +1,271 @@
+#include "pch.h"
+#include "SpatialGrid.h"
+
+#include "PhysicalCircle.h"
+
+using namespace Ecosim;
+using namespace std;
+using namespace glm;
+
+// keeps rounding in the cell reach from dropping a pair the narrow phase would keep
+const float CONTACT_SLACK = 1.0f;
+
+namespace
+{
+	/**	Tests one object against a run of packed objects,
+	 *	listing the lower handle index of each pair first.
+	 */
+	void addContacts(PhysicalCircle* obj, PhysicalCircle* const* begin, PhysicalCircle* const* end, vector<Contact>& results)
+	{
+		uint32_t key = obj->getHandle().index;
+		float radius = obj->getRadius();
+
+		for(PhysicalCircle* const* iter = begin; iter != end; ++iter)
+		{
+			PhysicalCircle* other = *iter;
+			PhysicalCircle* first = key < other->getHandle().index ? obj : other;
+			PhysicalCircle* second = first == obj ? other : obj;
+
+			SpatialGrid::testContact(*first, first->getPosition(), *second, second->getPosition(),
+				radius + other->getRadius(), results);
+		}
+	}
+}
+
+//-------------------------------------------------------------
+
+SpatialGrid::SpatialGrid(float cellSize) :
+	mCellSize(cellSize),
+	mInvCellSize(1.0f / cellSize),
+	mMaxRadius(0.0f),
+	mNumColumns(1),
+	mNumRows(1)
+{
+	assert(cellSize > 0.0f);
+	mCellStarts.assign(2, 0);
+}
+
+//-------------------------------------------------------------
+
+void SpatialGrid::setBounds(const vec2& bounds)
+{
+	mNumColumns = std::max(1u, static_cast<uint32_t>(ceil(bounds.x * mInvCellSize)));
+	mNumRows = std::max(1u, static_cast<uint32_t>(ceil(bounds.y * mInvCellSize)));
+
+	mObjects.clear();
+	mCellStarts.assign(mNumColumns * mNumRows + 1, 0);
+	mMaxRadius = 0.0f;
+}
+
+//-------------------------------------------------------------
+
+void SpatialGrid::build(const CollisionRegistry::Lists& objects)
+{
+	uint32_t numCells = mNumColumns * mNumRows;
+
+	// count objects per cell, remembering each object's cell for the fill pass
+	mCellStarts.assign(numCells + 1, 0);
+	mObjectCells.clear();
+	mMaxRadius = 0.0f;
+
+	for(const CollisionRegistry::Members* members : objects)
+	{
+		for(PhysicalCircle* obj : *members)
+		{
+			if(obj->isCollisionActive())
+			{
+				const vec3& pos = obj->getPosition();
+				uint32_t cell = cellCoord(pos.y, mNumRows) * mNumColumns + cellCoord(pos.x, mNumColumns);
+
+				mObjectCells.push_back(cell);
+				++mCellStarts[cell + 1];
+
+				mMaxRadius = std::max(mMaxRadius, obj->getRadius());
+			}
+		}
+	}
+
+	// prefix sum turns counts into start offsets
+	for(uint32_t i = 0; i < numCells; ++i)
+	{
+		mCellStarts[i + 1] += mCellStarts[i];
+	}
+
+	// fill cells -- a copy of the offsets serves as the write cursor per cell
+	mObjects.resize(mObjectCells.size());
+	vector<uint32_t> cursors(mCellStarts.begin(), mCellStarts.end() - 1);
+
+	uint32_t next = 0;
+	for(const CollisionRegistry::Members* members : objects)
+	{
+		for(PhysicalCircle* obj : *members)
+		{
+			if(obj->isCollisionActive())
+			{
+				mObjects[cursors[mObjectCells[next++]]++] = obj;
+			}
+		}
+	}
+}
+
+//-------------------------------------------------------------
+
+void SpatialGrid::query(const vec2& min, const vec2& max, vector<PhysicalCircle*>& results) const
+{
+	results.clear();
+
+	// objects are bucketed by center, so widen the search by the largest radius
+	uint32_t minColumn = cellCoord(min.x - mMaxRadius, mNumColumns);
+	uint32_t maxColumn = cellCoord(max.x + mMaxRadius, mNumColumns);
+	uint32_t minRow = cellCoord(min.y - mMaxRadius, mNumRows);
+	uint32_t maxRow = cellCoord(max.y + mMaxRadius, mNumRows);
+
+	for(uint32_t row = minRow; row <= maxRow; ++row)
+	{
+		// cells in a row are contiguous, so a run of columns is one range
+		uint32_t begin = mCellStarts[row * mNumColumns + minColumn];
+		uint32_t end = mCellStarts[row * mNumColumns + maxColumn + 1];
+
+		for(uint32_t i = begin; i < end; ++i)
+		{
+			PhysicalCircle* obj = mObjects[i];
+			const vec3& pos = obj->getPosition();
+			float radius = obj->getRadius();
+
+			if(pos.x + radius >= min.x && pos.x - radius <= max.x &&
+				pos.y + radius >= min.y && pos.y - radius <= max.y)
+			{
+				results.push_back(obj);
+			}
+		}
+	}
+}
+
+//-------------------------------------------------------------
+
+bool SpatialGrid::hasObjectNear(const vec2& point, float distance, const PhysicalCircle* ignore) const
+{
+	if(mObjects.empty())
+	{
+		return false;
+	}
+
+	uint32_t minColumn = cellCoord(point.x - distance - mMaxRadius, mNumColumns);
+	uint32_t maxColumn = cellCoord(point.x + distance + mMaxRadius, mNumColumns);
+	uint32_t minRow = cellCoord(point.y - distance - mMaxRadius, mNumRows);
+	uint32_t maxRow = cellCoord(point.y + distance + mMaxRadius, mNumRows);
+
+	for(uint32_t row = minRow; row <= maxRow; ++row)
+	{
+		uint32_t begin = mCellStarts[row * mNumColumns + minColumn];
+		uint32_t end = mCellStarts[row * mNumColumns + maxColumn + 1];
+
+		for(uint32_t i = begin; i < end; ++i)
+		{
+			const PhysicalCircle* obj = mObjects[i];
+			if(obj == ignore)
+			{
+				continue;
+			}
+
+			vec2 offset = vec2(obj->getPosition()) - point;
+			float reach = distance + obj->getRadius();
+			if(glm::dot(offset, offset) <= reach * reach)
+			{
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+//-------------------------------------------------------------
+
+void SpatialGrid::findContacts(vector<Contact>& results) const
+{
+	results.clear();
+	if(mObjects.empty())
+	{
+		return;
+	}
+
+	// objects are bucketed by center, so touching ones are at most two of the largest radii apart
+	uint32_t reach = std::max(1u, static_cast<uint32_t>(ceil((2.0f * mMaxRadius + CONTACT_SLACK) * mInvCellSize)));
+	PhysicalCircle* const* objects = mObjects.data();
+
+	for(uint32_t row = 0; row < mNumRows; ++row)
+	{
+		uint32_t lastRow = std::min(row + reach, mNumRows - 1);
+
+		for(uint32_t column = 0; column < mNumColumns; ++column)
+		{
+			uint32_t firstColumn = column > reach ? column - reach : 0;
+			uint32_t lastColumn = std::min(column + reach, mNumColumns - 1);
+
+			uint32_t cell = row * mNumColumns + column;
+			for(uint32_t i = mCellStarts[cell]; i < mCellStarts[cell + 1]; ++i)
+			{
+				// the rest of this cell and the cells after it in the row are one packed range
+				addContacts(objects[i], objects + i + 1, objects + mCellStarts[row * mNumColumns + lastColumn + 1], results);
+
+				// rows below are searched on both sides
+				for(uint32_t other = row + 1; other <= lastRow; ++other)
+				{
+					uint32_t begin = mCellStarts[other * mNumColumns + firstColumn];
+					uint32_t end = mCellStarts[other * mNumColumns + lastColumn + 1];
+					addContacts(objects[i], objects + begin, objects + end, results);
+				}
+			}
+		}
+	}
+}
+
+//-------------------------------------------------------------
+
+void SpatialGrid::testContact(PhysicalCircle& first, const vec3& firstPos, PhysicalCircle& second, const vec3& secondPos,
+	float reach, vector<Contact>& results)
+{
+	// squared distances, so only actual contacts pay for a square root
+	vec3 between = secondPos - firstPos;
+	float distanceSquared = glm::dot(between, between);
+
+	if(distanceSquared < reach * reach)
+	{
+		// coincident centers have no direction between them, so they split along x
+		vec3 normal = distanceSquared > 0.0f ? between * glm::inversesqrt(distanceSquared) : vec3(1.0f, 0.0f, 0.0f);
+		results.push_back(Contact{ &first, &second, normal });
+	}
+}
+
+//-------------------------------------------------------------
+
+void SpatialGrid::sortContacts(vector<Contact>& contacts)
+{
+	std::sort(contacts.begin(), contacts.end(), [](const Contact& a, const Contact& b)
+	{
+		uint32_t aFirst = a.first->getHandle().index;
+		uint32_t bFirst = b.first->getHandle().index;
+		return aFirst < bFirst || (aFirst == bFirst && a.second->getHandle().index < b.second->getHandle().index);
+	});
+}
+
+//-------------------------------------------------------------
+
+uint32_t SpatialGrid::size() const
+{
+	return static_cast<uint32_t>(mObjects.size());
+}
+
+//-------------------------------------------------------------
+
+uint32_t SpatialGrid::cellCoord(float coord, uint32_t numCells) const
+{
+	float cell = coord * mInvCellSize;
+	if(cell <= 0.0f)
+	{
+		return 0;
+	}
+
+	return std::min(static_cast<uint32_t>(cell), numCells - 1);
+}
@@ -0,0 +1,151 @@
+#pragma once
+
+#include "CollisionRegistry.h"
+
+namespace Ecosim
+{
+	/**	Two objects whose circles overlap.
+	 */
+	struct Contact
+	{
+		PhysicalCircle* first;
+		PhysicalCircle* second;
+
+		// unit vector from the first object's center toward the second's
+		glm::vec3 normal;
+	};
+
+	//=============================================================
+
+	/**	Uniform grid over the world that buckets
+	 *	PhysicalCircles by the cell holding their
+	 *	center.
+	 *
+	 *	The grid is rebuilt from scratch each time
+	 *	objects move. Cells are packed into a single
+	 *	array with a start offset per cell, so a build
+	 *	is two linear passes and a query only touches
+	 *	the cells under the search rectangle.
+	 *
+	 *	Contacts are found in one sweep over the cells.
+	 *	Each object is tested against the objects after it
+	 *	in its own cell and against the forward half of
+	 *	the cells around it, so every pair is tested once.
+	 */
+	class SpatialGrid final
+	{
+	public:
+
+		SpatialGrid(const SpatialGrid& other) = delete;
+		SpatialGrid& operator=(const SpatialGrid& other) = delete;
+		SpatialGrid(SpatialGrid&& other) = delete;
+		SpatialGrid& operator=(SpatialGrid&& other) = delete;
+
+		/**	@brief Constructor.
+		 *
+		 *	@param cellSize The width and height of each cell.
+		 */
+		explicit SpatialGrid(float cellSize);
+
+		/**	@brief Destructor.
+		 */
+		~SpatialGrid() = default;
+
+		/**	@brief Sizes the grid to cover the world.
+		 *		   Empties the grid.
+		 *
+		 *	@param bounds The size of the world.
+		 */
+		void setBounds(const glm::vec2& bounds);
+
+		/**	@brief Buckets every object with active collision.
+		 *		   Replaces the previous contents of the grid.
+		 *
+		 *	@param objects The lists of objects to bucket.
+		 */
+		void build(const CollisionRegistry::Lists& objects);
+
+		/**	@brief Finds every object whose circle overlaps
+		 *		   a rectangle.
+		 *
+		 *	@param min The xy of the rectangle's low corner.
+		 *	@param max The xy of the rectangle's high corner.
+		 *	@param results Cleared, then filled with the objects found.
+		 */
+		void query(const glm::vec2& min, const glm::vec2& max, std::vector<PhysicalCircle*>& results) const;
+
+		/**	@brief Checks whether any object's circle comes
+		 *		   within a distance of a point. Stops at the
+		 *		   first one found.
+		 *
+		 *	@param point The point.
+		 *	@param distance How far from the point to look.
+		 *	@param ignore An object to skip, or nullptr.
+		 *
+		 *	@return Returns true if an object is that near.
+		 */
+		bool hasObjectNear(const glm::vec2& point, float distance, const PhysicalCircle* ignore) const;
+
+		/**	@brief Finds every pair of objects whose circles
+		 *		   overlap, as they stood at the last build.
+		 *		   Each pair is listed once, with its lower
+		 *		   handle index first.
+		 *
+		 *	@param results Cleared, then filled with the contacts
+		 *				   found, in grid order.
+		 */
+		void findContacts(std::vector<Contact>& results) const;
+
+		/**	@brief Narrow phase for one pair. Adds a contact
+		 *		   if the circles overlap.
+		 *
+		 *	@param first The object the contact lists first.
+		 *	@param firstPos Its position.
+		 *	@param second The other object.
+		 *	@param secondPos Its position.
+		 *	@param reach The sum of their radii.
+		 *	@param results Receives the contact, if any.
+		 */
+		static void testContact(PhysicalCircle& first, const glm::vec3& firstPos, PhysicalCircle& second, const glm::vec3& secondPos,
+			float reach, std::vector<Contact>& results);
+
+		/**	@brief Puts contacts in order of their objects'
+		 *		   handle indices, so the order doesn't depend
+		 *		   on how they were found.
+		 *
+		 *	@param contacts The contacts, each with its lower
+		 *					handle index first.
+		 */
+		static void sortContacts(std::vector<Contact>& contacts);
+
+		/**	@brief Gets the number of objects in the grid.
+		 *
+		 *	@return Returns the length of mObjects.
+		 */
+		std::uint32_t size() const;
+
+	private:
+
+		/**	@brief Gets the cell column or row for a
+		 *		   coordinate, clamped to the grid.
+		 *
+		 *	@param coord The x or y coordinate.
+		 *	@param numCells The number of columns or rows.
+		 *
+		 *	@return Returns the column or row.
+		 */
+		std::uint32_t cellCoord(float coord, std::uint32_t numCells) const;
+
+
+		std::vector<PhysicalCircle*> mObjects;
+		std::vector<std::uint32_t> mCellStarts;
+		std::vector<std::uint32_t> mObjectCells;
+
+		float mCellSize;
+		float mInvCellSize;
+		float mMaxRadius;
+
+		std::uint32_t mNumColumns;
+		std::uint32_t mNumRows;
+	};
+}
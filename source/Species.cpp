@@ -0,0 +1,80 @@
+#include "pch.h"
+#include "Species.h"
+
+#include "Prey.h"
+#include "Predator.h"
+#include "Resource.h"
+#include "ResourceEffects.h"
+
+using namespace Ecosim;
+using namespace std;
+using namespace glm;
+
+namespace
+{
+	template <typename T>
+	Agent* create()
+	{
+		return new T();
+	}
+
+	/**	Every species, indexed by Species::ID. Inputs are
+	 *	a block of cones per visible type, then status,
+	 *	then a pair of samples per scent type.
+	 */
+	const Species SPECIES[Species::COUNT] =
+	{
+		{
+			Species::AGENT, "agent", &Agent::classTypeID, &create<Agent>,
+			{ &Resource<Food>::classTypeID, &Resource<Water>::classTypeID, &Agent::classTypeID }, 3,
+			{ &Resource<Water>::classTypeID, &Resource<Food>::classTypeID, &Agent::classTypeID }, 3,
+			{}, 0,
+			8, 27, NETWORK_NUM_OUT,
+			vec3(0.85f, 0.85f, 0.85f)
+		},
+		{
+			Species::PREY, "prey", &Prey::classTypeID, &create<Prey>,
+			{ &Resource<Food>::classTypeID, &Resource<Water>::classTypeID, &Predator::classTypeID }, 3,
+			{ &Resource<Water>::classTypeID, &Resource<Food>::classTypeID, &Agent::classTypeID }, 3,
+			{}, 0,
+			8, 27, NETWORK_NUM_OUT,
+			vec3(1.0f, 1.0f, 0.5f)
+		},
+		{
+			Species::PREDATOR, "predator", &Predator::classTypeID, &create<Predator>,
+			{ &Resource<Water>::classTypeID, &Prey::classTypeID }, 2,
+			{ &Resource<Water>::classTypeID, &Agent::classTypeID }, 2,
+			{ &Prey::classTypeID }, 1,
+			8, 21, NETWORK_NUM_OUT,
+			vec3(1.0f, 0.5f, 0.5f)
+		}
+	};
+}
+
+//-------------------------------------------------------------
+
+const Species& Species::get(ID id)
+{
+	assert(id < COUNT);
+
+	const Species& species = SPECIES[id];
+	assert(species.id == id);
+	assert(species.numCones == 4 || species.numCones == 8 || species.numCones == 16 || species.numCones == 32);
+	assert(species.numInputs == species.numVisibleTypes * species.numCones + NETWORK_NUM_IN_STATUS +
+		species.numScentTypes * NUM_SCENT_SAMPLES);
+	assert(species.numInputs >= NETWORK_MIN_IN && species.numInputs <= NETWORK_MAX_IN);
+	assert(species.numOutputs == NETWORK_NUM_OUT);
+	return species;
+}
+
+//-------------------------------------------------------------
+
+const Species& Species::forGenome(bool isPrey)
+{
+#if USES_PREDATOR_PREY
+	return get(isPrey ? PREY : PREDATOR);
+#else
+	UNREFERENCED_PARAMETER(isPrey);
+	return get(AGENT);
+#endif
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+namespace Ecosim
+{
+	class Agent;
+
+	/**	Static description of one kind of Agent: what
+	 *	it can see and collide with, how finely it sees,
+	 *	and the shape of its network.
+	 *
+	 *	Species are declared as a table in Species.cpp.
+	 *	Each visible type fills one perception block of
+	 *	numCones inputs, in table order. The status
+	 *	inputs come next, then a pair of inputs for each
+	 *	type the species can smell, read from that type's
+	 *	ScentField ahead-left and ahead-right of the
+	 *	Agent. Scent goes last so that Genomes written
+	 *	before it keep their sensor numbers. The
+	 *	AgentManager runs perception
+	 *	and collisions for a whole species at a time from
+	 *	these lists, so adding a species is a table entry
+	 *	and an Agent class, with no per-Agent overrides.
+	 */
+	struct Species
+	{
+		enum ID
+		{
+			AGENT,
+			PREY,
+			PREDATOR,
+			COUNT
+		};
+
+		typedef std::uint64_t (*TypeIDGetter)();
+		typedef Agent* (*Factory)();
+
+		static const std::uint32_t MAX_TYPES = 4;
+		static const std::uint32_t NUM_SCENT_SAMPLES = 2;
+
+		ID id;
+		const char* name;
+		TypeIDGetter agentType;
+		Factory create;
+
+		// objects that fill perception blocks, in input order
+		TypeIDGetter visibleTypes[MAX_TYPES];
+		std::uint32_t numVisibleTypes;
+
+		// objects whose collisions are handled, in check order
+		TypeIDGetter collidableTypes[MAX_TYPES];
+		std::uint32_t numCollidableTypes;
+
+		// objects whose ScentFields fill scent inputs, in input order
+		TypeIDGetter scentTypes[MAX_TYPES];
+		std::uint32_t numScentTypes;
+
+		// 4, 8, 16, or 32 -- each has its own perception kernel
+		std::uint32_t numCones;
+		std::uint32_t numInputs;
+		std::uint32_t numOutputs;
+
+		glm::vec3 color;
+
+		/**	@brief Gets a species from the table.
+		 *
+		 *	@param id The species.
+		 *
+		 *	@return Returns the table entry.
+		 */
+		static const Species& get(ID id);
+
+		/**	@brief Gets the species a Genome builds, by the
+		 *		   prey flag in its header. Without predator
+		 *		   and prey, every Genome builds a plain Agent.
+		 *
+		 *	@param isPrey The Genome's prey flag.
+		 *
+		 *	@return Returns the table entry.
+		 */
+		static const Species& forGenome(bool isPrey);
+	};
+}
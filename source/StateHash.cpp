@@ -0,0 +1,71 @@
+#include "pch.h"
+#include "StateHash.h"
+
+#include <cstring>
+
+using namespace Ecosim;
+using namespace std;
+using namespace glm;
+
+const uint64_t HASH_MULTIPLIER = 0x9E3779B97F4A7C15ull;
+
+StateHash::StateHash(uint64_t seed) :
+	mState(seed)
+{
+}
+
+//-------------------------------------------------------------
+
+void StateHash::add(uint64_t value)
+{
+	mState = (mState ^ value) * HASH_MULTIPLIER;
+	mState ^= mState >> 32;
+}
+
+//-------------------------------------------------------------
+
+void StateHash::add(float value)
+{
+	uint32_t bits;
+	memcpy(&bits, &value, sizeof(bits));
+	add(static_cast<uint64_t>(bits));
+}
+
+//-------------------------------------------------------------
+
+void StateHash::add(double value)
+{
+	uint64_t bits;
+	memcpy(&bits, &value, sizeof(bits));
+	add(bits);
+}
+
+//-------------------------------------------------------------
+
+void StateHash::add(const vec3& value)
+{
+	add(value.x);
+	add(value.y);
+	add(value.z);
+}
+
+//-------------------------------------------------------------
+
+void StateHash::add(const float* values, size_t count)
+{
+	for(size_t i = 0; i < count; ++i)
+	{
+		add(values[i]);
+	}
+}
+
+//-------------------------------------------------------------
+
+uint64_t StateHash::get() const
+{
+	// SplitMix64 finalizer, so nearby states give unrelated hashes
+	uint64_t value = mState;
+	value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+	value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+	return value ^ (value >> 31);
+}
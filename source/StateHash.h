@@ -0,0 +1,81 @@
+#pragma once
+
+namespace Ecosim
+{
+	/**	Fast, order-sensitive 64-bit hash of simulation
+	 *	state. Values are hashed by their exact bits, so
+	 *	any difference at all -- even in the last bit of
+	 *	a float -- changes the result.
+	 */
+	class StateHash final
+	{
+	public:
+
+		/**	@brief Constructor.
+		 *
+		 *	@param seed The starting value.
+		 */
+		explicit StateHash(std::uint64_t seed = 0);
+
+		/**	@brief Destructor.
+		 */
+		~StateHash() = default;
+
+		/**	@brief Mixes in an integer.
+		 *
+		 *	@param value The value.
+		 */
+		void add(std::uint64_t value);
+
+		/**	@brief Mixes in the bits of a float.
+		 *
+		 *	@param value The value.
+		 */
+		void add(float value);
+
+		/**	@brief Mixes in the bits of a double.
+		 *
+		 *	@param value The value.
+		 */
+		void add(double value);
+
+		/**	@brief Mixes in the bits of each component
+		 *		   of a vector.
+		 *
+		 *	@param value The value.
+		 */
+		void add(const glm::vec3& value);
+
+		/**	@brief Mixes in the bits of an array of floats.
+		 *
+		 *	@param values The array.
+		 *	@param count The number of values.
+		 */
+		void add(const float* values, std::size_t count);
+
+		/**	@brief Gets the hash of everything mixed in.
+		 *
+		 *	@return Returns the finalized hash.
+		 */
+		std::uint64_t get() const;
+
+	private:
+
+		std::uint64_t mState;
+	};
+
+	//=============================================================
+
+	/**	The state hash of one object in a World, tagged
+	 *	so a mismatch can be traced back to its owner.
+	 */
+	struct EntityHash
+	{
+		const char* kind;
+		std::uint32_t group;
+		std::uint32_t index;
+		std::uint64_t hash;
+	};
+
+	typedef std::vector<EntityHash> EntityHashes;
+}
@@ -0,0 +1,309 @@
+#include "pch.h"
+#include "SweepRunner.h"
+
+#include "ThreadPool.h"
+
+using namespace Ecosim;
+using namespace std::chrono;
+using namespace std;
+using namespace glm;
+
+const float SECONDS_PER_MINUTE = 60.0f;
+
+// fitness is sampled this often for the run means, in simulated seconds
+const float FITNESS_SAMPLE_INTERVAL = 1.0f;
+
+bool SweepRunner::init(const string& filename, const vec2& worldSize)
+{
+	ifstream specFile;
+	specFile.open(filename, ifstream::in);
+	if(!specFile.is_open())
+	{
+		cout << "Sweep -- cannot open " << filename << endl;
+		return false;
+	}
+
+	mSpec = SweepSpec();
+	mSpec.worldSize = worldSize;
+
+	bool isValid = readSpec(specFile);
+	specFile.close();
+
+	if(isValid)
+	{
+		buildRuns();
+	}
+
+	return isValid;
+}
+
+//-------------------------------------------------------------
+
+int32_t SweepRunner::run()
+{
+	if(mRuns.empty())
+	{
+		return -1;
+	}
+
+	// pool finishes every run before it goes away
+	{
+		ThreadPool pool(mSpec.numThreads);
+		cout << "Sweep -- " << mRuns.size() << " runs on " << pool.getNumThreads() << " threads" << endl;
+
+		for(SweepRun& run : mRuns)
+		{
+			pool.enqueue([&run, this]() { runWorld(run, mSpec); });
+		}
+	}
+
+	if(mSpec.outputFile.empty())
+	{
+		writeResults(cout);
+	}
+	else
+	{
+		ofstream resultsFile;
+		resultsFile.open(mSpec.outputFile, ofstream::out | ofstream::trunc);
+		writeResults(resultsFile);
+		resultsFile.close();
+
+		cout << "Sweep -- results written to " << mSpec.outputFile << endl;
+	}
+
+	return 0;
+}
+
+//-------------------------------------------------------------
+
+bool SweepRunner::readSpec(istream& stream)
+{
+	string line;
+	while(getline(stream, line))
+	{
+		istringstream lineStream(line);
+
+		string key;
+		if(!(lineStream >> key) || key[0] == '#')
+		{
+			continue;
+		}
+
+		if(key == "duration")
+		{
+			lineStream >> mSpec.duration;
+		}
+		else if(key == "timestep")
+		{
+			lineStream >> mSpec.timeStep;
+		}
+		else if(key == "threads")
+		{
+			lineStream >> mSpec.numThreads;
+		}
+		else if(key == "samples")
+		{
+			lineStream >> mSpec.numSamples;
+		}
+		else if(key == "sampleseed")
+		{
+			lineStream >> mSpec.sampleSeed;
+		}
+		else if(key == "seeds")
+		{
+			uint64_t seed;
+			while(lineStream >> seed)
+			{
+				mSpec.seeds.push_back(seed);
+			}
+		}
+		else if(key == "output")
+		{
+			lineStream >> mSpec.outputFile;
+		}
+		else if(key == "grid" || key == "range")
+		{
+			string name;
+			lineStream >> name;
+
+			SimParams::Field field = SimParams::findField(name);
+			if(field == nullptr)
+			{
+				cout << "Sweep -- unknown parameter " << name << endl;
+				return false;
+			}
+
+			if(key == "grid")
+			{
+				SweepSpec::GridParam param{ name, field, {} };
+
+				float value;
+				while(lineStream >> value)
+				{
+					param.values.push_back(value);
+				}
+
+				mSpec.gridParams.push_back(param);
+			}
+			else
+			{
+				SweepSpec::RangeParam param{ name, field, 0.0f, 0.0f };
+				lineStream >> param.min >> param.max;
+				mSpec.rangeParams.push_back(param);
+			}
+		}
+		else
+		{
+			cout << "Sweep -- unknown setting " << key << endl;
+			return false;
+		}
+	}
+
+	if(mSpec.seeds.empty())
+	{
+		mSpec.seeds.push_back(0);
+	}
+
+	return true;
+}
+
+//-------------------------------------------------------------
+
+void SweepRunner::buildRuns()
+{
+	mRuns.clear();
+
+	// range params draw from their own stream, so samples repeat with the sweep file
+	Rng sampler(mSpec.sampleSeed);
+
+	// a grid param with no values would leave nothing to combine
+	size_t numCombinations = 1;
+	for(const SweepSpec::GridParam& param : mSpec.gridParams)
+	{
+		numCombinations *= param.values.size();
+	}
+
+	for(size_t combination = 0; combination < numCombinations; ++combination)
+	{
+		for(uint32_t sample = 0; sample < mSpec.numSamples; ++sample)
+		{
+			SweepRun run;
+
+			// decode the combination, first grid param varying fastest
+			size_t remainder = combination;
+			for(const SweepSpec::GridParam& param : mSpec.gridParams)
+			{
+				float value = param.values[remainder % param.values.size()];
+				remainder /= param.values.size();
+
+				run.params.*param.field = value;
+				run.values.push_back(value);
+			}
+
+			for(const SweepSpec::RangeParam& param : mSpec.rangeParams)
+			{
+				float value = sampler.range(param.min, param.max);
+
+				run.params.*param.field = value;
+				run.values.push_back(value);
+			}
+
+			// every seed sees the same sampled values
+			for(uint64_t seed : mSpec.seeds)
+			{
+				run.seed = seed;
+				mRuns.push_back(run);
+			}
+		}
+	}
+}
+
+//-------------------------------------------------------------
+
+void SweepRunner::writeResults(ostream& stream) const
+{
+	stream << "run,seed";
+	for(const SweepSpec::GridParam& param : mSpec.gridParams)
+	{
+		stream << "," << param.name;
+	}
+	for(const SweepSpec::RangeParam& param : mSpec.rangeParams)
+	{
+		stream << "," << param.name;
+	}
+	stream << ",prey_final_best,prey_final_mean,prey_run_mean" <<
+		",pred_final_best,pred_final_mean,pred_run_mean" <<
+		",ticks,seconds,ticks_per_second" << endl;
+
+	for(size_t i = 0; i < mRuns.size(); ++i)
+	{
+		const SweepRun& run = mRuns[i];
+
+		stream << i << "," << run.seed;
+		for(float value : run.values)
+		{
+			stream << "," << value;
+		}
+
+		double ticksPerSecond = run.elapsedSeconds > 0.0 ? run.numTicks / run.elapsedSeconds : 0.0;
+		stream <<
+			"," << run.finalPrey.best << "," << run.finalPrey.mean << "," << run.runMeanPrey <<
+			"," << run.finalPredator.best << "," << run.finalPredator.mean << "," << run.runMeanPredator <<
+			"," << run.numTicks << "," << run.elapsedSeconds << "," << ticksPerSecond << endl;
+	}
+}
+
+//-------------------------------------------------------------
+
+void SweepRunner::runWorld(SweepRun& run, const SweepSpec& spec)
+{
+	World world;
+	World::Scope scope(world);
+
+	// sweeps share the genome files, but never write them back or log to them
+	WorldConfig worldConfig;
+	worldConfig.bounds = spec.worldSize;
+	worldConfig.params = run.params;
+	worldConfig.seed = run.seed;
+	worldConfig.savesGenomes = false;
+	worldConfig.logsFitness = false;
+	world.init(worldConfig);
+
+	SimClock clock;
+	float endTime = spec.duration * SECONDS_PER_MINUTE;
+	float nextSample = FITNESS_SAMPLE_INTERVAL;
+
+	float totalPrey = 0.0f;
+	float totalPredator = 0.0f;
+	uint32_t numSamples = 0;
+
+	const AgentManager& agentManager = world.getAgentManager();
+
+	steady_clock::time_point startTime = steady_clock::now();
+	while(clock.getTotalTime() < endTime)
+	{
+		clock.step(spec.timeStep);
+		world.update(clock);
+		++run.numTicks;
+
+		if(clock.getTotalTime() >= nextSample)
+		{
+			totalPrey += agentManager.getFitnessSummary(true).mean;
+			totalPredator += agentManager.getFitnessSummary(false).mean;
+			++numSamples;
+
+			nextSample += FITNESS_SAMPLE_INTERVAL;
+		}
+	}
+	run.elapsedSeconds = duration_cast<duration<double>>(steady_clock::now() - startTime).count();
+
+	run.finalPrey = agentManager.getFitnessSummary(true);
+	run.finalPredator = agentManager.getFitnessSummary(false);
+	if(numSamples > 0)
+	{
+		run.runMeanPrey = totalPrey / numSamples;
+		run.runMeanPredator = totalPredator / numSamples;
+	}
+
+	world.shutdown();
+}
@@ -0,0 +1,160 @@
+#pragma once
+
+#include "AgentManager.h"
+#include "World.h"
+
+namespace Ecosim
+{
+	/**	Description of a parameter sweep, as read from
+	 *	a sweep file.
+	 *
+	 *	Every combination of grid values is run. Each
+	 *	combination is sampled numSamples times, with
+	 *	range parameters drawn uniformly on each sample,
+	 *	and each sample is run once per seed.
+	 */
+	struct SweepSpec
+	{
+		struct GridParam
+		{
+			std::string name;
+			SimParams::Field field;
+			std::vector<float> values;
+		};
+
+		struct RangeParam
+		{
+			std::string name;
+			SimParams::Field field;
+			float min;
+			float max;
+		};
+
+		glm::vec2 worldSize = glm::vec2(0.0f, 0.0f);
+
+		std::vector<GridParam> gridParams;
+		std::vector<RangeParam> rangeParams;
+		std::uint32_t numSamples = 1;
+		std::uint64_t sampleSeed = 0;
+		std::vector<std::uint64_t> seeds;
+
+		float duration = 10.0f;				// simulated minutes
+		float timeStep = 1.0f / 60.0f;		// simulated seconds per tick
+		std::uint32_t numThreads = 0;		// 0 is one per hardware thread
+
+		std::string outputFile;
+	};
+
+	//=============================================================
+
+	/**	One configuration of a sweep and its results.
+	 */
+	struct SweepRun
+	{
+		SimParams params;
+		std::vector<float> values;			// swept values, grid params then range params
+		std::uint64_t seed = 0;
+
+		FitnessSummary finalPrey;
+		FitnessSummary finalPredator;
+		float runMeanPrey = 0.0f;
+		float runMeanPredator = 0.0f;
+
+		std::uint64_t numTicks = 0;
+		double elapsedSeconds = 0.0;
+	};
+
+	//=============================================================
+
+	/**	Batch mode that runs every configuration of a
+	 *	parameter sweep as a headless World on a thread
+	 *	pool, then writes a table of results.
+	 *
+	 *	A sweep file holds one setting per line; blank
+	 *	lines and lines starting with # are skipped.
+	 *
+	 *		duration <simulated minutes>
+	 *		timestep <simulated seconds>
+	 *		threads <count>
+	 *		samples <count>
+	 *		sampleseed <seed>
+	 *		seeds <seed> [seed...]
+	 *		grid <param> <value> [value...]
+	 *		range <param> <min> <max>
+	 *		output <csv file>
+	 *
+	 *	Parameter names are the members of SimParams.
+	 */
+	class SweepRunner final
+	{
+	public:
+
+		SweepRunner(const SweepRunner& other) = delete;
+		SweepRunner& operator=(const SweepRunner& other) = delete;
+		SweepRunner(SweepRunner&& other) = delete;
+		SweepRunner& operator=(SweepRunner&& other) = delete;
+
+		/**	@brief Constructor.
+		 */
+		SweepRunner() = default;
+
+		/**	@brief Destructor.
+		 */
+		~SweepRunner() = default;
+
+		/**	@brief Reads a sweep file and lays out every
+		 *		   configuration it describes.
+		 *
+		 *	@param filename The sweep file.
+		 *	@param worldSize The xy size of each World.
+		 *
+		 *	@return Returns true if the file was read.
+		 *			Returns false if it is missing or holds
+		 *			a setting or parameter we don't know.
+		 */
+		bool init(const std::string& filename, const glm::vec2& worldSize);
+
+		/**	@brief Runs every configuration, then writes the
+		 *		   results to the output file, or to stdout
+		 *		   if the sweep names none.
+		 *
+		 *	@return Returns 0 if the sweep completes. Returns
+		 *			-1 if there is nothing to run.
+		 */
+		std::int32_t run();
+
+	private:
+
+		/**	@brief Parses the settings of a sweep file.
+		 *
+		 *	@param stream The stream holding the sweep file.
+		 *
+		 *	@return Returns true if every line was understood.
+		 */
+		bool readSpec(std::istream& stream);
+
+		/**	@brief Lays out one run per grid combination,
+		 *		   sample, and seed.
+		 */
+		void buildRuns();
+
+		/**	@brief Writes one row per run, giving its swept
+		 *		   values, fitness per species, and throughput.
+		 *
+		 *	@param stream The stream to which we write.
+		 */
+		void writeResults(std::ostream& stream) const;
+
+		/**	@brief Runs one configuration to completion.
+		 *		   Runs on a pool thread.
+		 *
+		 *	@param run The configuration. Receives the results.
+		 *	@param spec The sweep the run belongs to.
+		 */
+		static void runWorld(SweepRun& run, const SweepSpec& spec);
+
+
+		SweepSpec mSpec;
+		std::vector<SweepRun> mRuns;
+	};
+}
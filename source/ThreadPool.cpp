@@ -0,0 +1,95 @@
+#include "pch.h"
+#include "ThreadPool.h"
+
+using namespace Ecosim;
+using namespace std;
+using namespace glm;
+
+ThreadPool::ThreadPool(uint32_t numThreads) :
+	mNumBusy(0),
+	mIsStopping(false)
+{
+	if(numThreads == 0)
+	{
+		numThreads = std::max(std::thread::hardware_concurrency(), 1u);
+	}
+
+	mWorkers.reserve(numThreads);
+	for(uint32_t i = 0; i < numThreads; ++i)
+	{
+		mWorkers.emplace_back(&ThreadPool::runWorker, this);
+	}
+}
+
+//-------------------------------------------------------------
+
+ThreadPool::~ThreadPool()
+{
+	{
+		lock_guard<mutex> lock(mMutex);
+		mIsStopping = true;
+	}
+	mTaskReady.notify_all();
+
+	for(std::thread& worker : mWorkers)
+	{
+		worker.join();
+	}
+}
+
+//-------------------------------------------------------------
+
+void ThreadPool::enqueue(Task task)
+{
+	{
+		lock_guard<mutex> lock(mMutex);
+		mTasks.push(std::move(task));
+	}
+	mTaskReady.notify_one();
+}
+
+//-------------------------------------------------------------
+
+void ThreadPool::waitIdle()
+{
+	unique_lock<mutex> lock(mMutex);
+	mIdle.wait(lock, [this]() { return mTasks.empty() && mNumBusy == 0; });
+}
+
+//-------------------------------------------------------------
+
+uint32_t ThreadPool::getNumThreads() const
+{
+	return static_cast<uint32_t>(mWorkers.size());
+}
+
+//-------------------------------------------------------------
+
+void ThreadPool::runWorker()
+{
+	unique_lock<mutex> lock(mMutex);
+	for(;;)
+	{
+		mTaskReady.wait(lock, [this]() { return mIsStopping || !mTasks.empty(); });
+
+		// drain the queue before stopping
+		if(mTasks.empty())
+		{
+			return;
+		}
+
+		Task task = std::move(mTasks.front());
+		mTasks.pop();
+		++mNumBusy;
+
+		lock.unlock();
+		task();
+		lock.lock();
+
+		--mNumBusy;
+		if(mTasks.empty() && mNumBusy == 0)
+		{
+			mIdle.notify_all();
+		}
+	}
+}
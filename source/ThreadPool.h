@@ -0,0 +1,65 @@
+#pragma once
+
+namespace Ecosim
+{
+	/**	Fixed set of worker threads that run queued
+	 *	tasks in the order they were queued.
+	 */
+	class ThreadPool final
+	{
+	public:
+
+		typedef std::function<void()> Task;
+
+		ThreadPool(const ThreadPool& other) = delete;
+		ThreadPool& operator=(const ThreadPool& other) = delete;
+		ThreadPool(ThreadPool&& other) = delete;
+		ThreadPool& operator=(ThreadPool&& other) = delete;
+
+		/**	@brief Constructor. Starts the workers.
+		 *
+		 *	@param numThreads The number of workers. If 0,
+		 *					  one per hardware thread.
+		 */
+		explicit ThreadPool(std::uint32_t numThreads = 0);
+
+		/**	@brief Destructor. Finishes every queued task,
+		 *		   then stops the workers.
+		 */
+		~ThreadPool();
+
+		/**	@brief Queues a task to run on a worker.
+		 *
+		 *	@param task The task. Moved.
+		 */
+		void enqueue(Task task);
+
+		/**	@brief Blocks until every queued task has run.
+		 */
+		void waitIdle();
+
+		/**	@brief Gets the number of workers.
+		 *
+		 *	@return Returns the length of mWorkers.
+		 */
+		std::uint32_t getNumThreads() const;
+
+	private:
+
+		/**	@brief Runs tasks until the pool shuts down.
+		 *		   Each worker thread runs this.
+		 */
+		void runWorker();
+
+
+		std::vector<std::thread> mWorkers;
+		std::queue<Task> mTasks;
+
+		std::mutex mMutex;
+		std::condition_variable mTaskReady;
+		std::condition_variable mIdle;
+
+		std::uint32_t mNumBusy;
+		bool mIsStopping;
+	};
+}
@@ -0,0 +1,322 @@
+#include "pch.h"
+#include "TileGrid.h"
+
+#include "World.h"
+
+#include <cfloat>
+
+using namespace Ecosim;
+using namespace std;
+using namespace glm;
+
+// keeps rounding in the sweep bounds from dropping a pair the narrow phase would keep
+const float CONTACT_SLACK = 1.0f;
+
+TileGrid::TileGrid() :
+	mTileSize(0.0f, 0.0f),
+	mNumColumns(0),
+	mNumRows(0)
+{
+}
+
+//-------------------------------------------------------------
+
+TileGrid::~TileGrid()
+{
+	clear();
+}
+
+//-------------------------------------------------------------
+
+void TileGrid::init(uint32_t numTiles)
+{
+	clear();
+
+	mWorkers.reset();
+	mTiles.clear();
+	mTiles.resize(numTiles);
+	mNumColumns = 0;
+	mNumRows = 0;
+
+	if(numTiles > 0)
+	{
+		mWorkers.reset(new ThreadPool(numTiles));
+	}
+}
+
+//-------------------------------------------------------------
+
+void TileGrid::setBounds(const vec2& bounds)
+{
+	clear();
+
+	uint32_t numTiles = getNumTiles();
+	if(numTiles == 0)
+	{
+		return;
+	}
+
+	// of the ways to factor the count, take the one with the squarest tiles
+	float width = std::max(bounds.x, 1.0f);
+	float height = std::max(bounds.y, 1.0f);
+	float bestScore = FLT_MAX;
+	for(uint32_t numColumns = 1; numColumns <= numTiles; ++numColumns)
+	{
+		if(numTiles % numColumns == 0)
+		{
+			uint32_t numRows = numTiles / numColumns;
+			float score = glm::abs(glm::log((width / numColumns) / (height / numRows)));
+			if(score < bestScore)
+			{
+				bestScore = score;
+				mNumColumns = numColumns;
+				mNumRows = numRows;
+			}
+		}
+	}
+
+	mTileSize = vec2(bounds.x / mNumColumns, bounds.y / mNumRows);
+	for(uint32_t row = 0; row < mNumRows; ++row)
+	{
+		for(uint32_t column = 0; column < mNumColumns; ++column)
+		{
+			Tile& tile = mTiles[row * mNumColumns + column];
+			tile.min = vec2(column * mTileSize.x, row * mTileSize.y);
+			tile.max = tile.min + mTileSize;
+		}
+	}
+}
+
+//-------------------------------------------------------------
+
+void TileGrid::migrate(const CollisionRegistry::Lists& objects)
+{
+	for(const CollisionRegistry::Members* members : objects)
+	{
+		for(PhysicalCircle* obj : *members)
+		{
+			if(!obj->isCollisionActive())
+			{
+				remove(*obj);
+				continue;
+			}
+
+			// only objects that crossed an edge, or are new, change hands
+			uint32_t index = tileIndex(obj->getPosition());
+			if(obj->mTileIndex != index)
+			{
+				remove(*obj);
+				add(*obj, index);
+			}
+		}
+	}
+}
+
+//-------------------------------------------------------------
+
+void TileGrid::remove(PhysicalCircle& obj)
+{
+	if(obj.mTileIndex == UINT32_MAX)
+	{
+		return;
+	}
+
+	// swap the last owned object into the hole
+	vector<PhysicalCircle*>& owned = mTiles[obj.mTileIndex].owned;
+	PhysicalCircle* last = owned.back();
+	owned[obj.mTileSlot] = last;
+	last->mTileSlot = obj.mTileSlot;
+	owned.pop_back();
+
+	obj.mTileIndex = UINT32_MAX;
+}
+
+//-------------------------------------------------------------
+
+void TileGrid::forEachTile(const TileTask& task)
+{
+	assert(mWorkers != nullptr);
+
+	World& world = World::current();
+	for(Tile& tile : mTiles)
+	{
+		Tile* target = &tile;
+		mWorkers->enqueue([&world, &task, target]()
+		{
+			World::Scope scope(world);
+			task(*target);
+		});
+	}
+
+	mWorkers->waitIdle();
+}
+
+//-------------------------------------------------------------
+
+void TileGrid::findContacts(vector<Contact>& results)
+{
+	results.clear();
+
+	// ghosts are picked against where each tile's objects ended up, not its rectangle
+	forEachTile([](Tile& tile)
+	{
+		tile.extentMin = vec2(FLT_MAX, FLT_MAX);
+		tile.extentMax = vec2(-FLT_MAX, -FLT_MAX);
+		tile.maxRadius = 0.0f;
+
+		for(PhysicalCircle* obj : tile.owned)
+		{
+			if(obj->isCollisionActive())
+			{
+				vec2 pos(obj->getPosition());
+				tile.extentMin = glm::min(tile.extentMin, pos);
+				tile.extentMax = glm::max(tile.extentMax, pos);
+				tile.maxRadius = std::max(tile.maxRadius, obj->getRadius());
+			}
+		}
+	});
+
+	float maxRadius = 0.0f;
+	for(const Tile& tile : mTiles)
+	{
+		maxRadius = std::max(maxRadius, tile.maxRadius);
+	}
+
+	// touching centers are at most two of the largest radii apart
+	float ghostWidth = 2.0f * maxRadius + CONTACT_SLACK;
+	forEachTile([this, ghostWidth, maxRadius](Tile& tile)
+	{
+		sweepTile(tile, ghostWidth, maxRadius);
+	});
+
+	for(const Tile& tile : mTiles)
+	{
+		results.insert(results.end(), tile.contacts.begin(), tile.contacts.end());
+	}
+
+	SpatialGrid::sortContacts(results);
+}
+
+//-------------------------------------------------------------
+
+uint32_t TileGrid::getNumTiles() const
+{
+	return static_cast<uint32_t>(mTiles.size());
+}
+
+//-------------------------------------------------------------
+
+const TileGrid::Tile& TileGrid::getTile(uint32_t index) const
+{
+	assert(index < mTiles.size());
+	return mTiles[index];
+}
+
+//-------------------------------------------------------------
+
+uint32_t TileGrid::tileIndex(const vec3& pos) const
+{
+	float column = mTileSize.x > 0.0f ? pos.x / mTileSize.x : 0.0f;
+	float row = mTileSize.y > 0.0f ? pos.y / mTileSize.y : 0.0f;
+
+	uint32_t x = column <= 0.0f ? 0 : std::min(static_cast<uint32_t>(column), mNumColumns - 1);
+	uint32_t y = row <= 0.0f ? 0 : std::min(static_cast<uint32_t>(row), mNumRows - 1);
+	return y * mNumColumns + x;
+}
+
+//-------------------------------------------------------------
+
+void TileGrid::add(PhysicalCircle& obj, uint32_t index)
+{
+	assert(obj.mTileIndex == UINT32_MAX);
+
+	vector<PhysicalCircle*>& owned = mTiles[index].owned;
+	obj.mTileIndex = index;
+	obj.mTileSlot = static_cast<uint32_t>(owned.size());
+	owned.push_back(&obj);
+}
+
+//-------------------------------------------------------------
+
+void TileGrid::clear()
+{
+	for(Tile& tile : mTiles)
+	{
+		for(PhysicalCircle* obj : tile.owned)
+		{
+			obj->mTileIndex = UINT32_MAX;
+		}
+		tile.owned.clear();
+	}
+}
+
+//-------------------------------------------------------------
+
+void TileGrid::sweepTile(Tile& tile, float ghostWidth, float maxRadius) const
+{
+	tile.entries.clear();
+	tile.contacts.clear();
+
+	for(PhysicalCircle* obj : tile.owned)
+	{
+		if(obj->isCollisionActive())
+		{
+			tile.entries.push_back(Entry{ obj->getPosition(), obj->getRadius(), obj, obj->getHandle().index, true });
+		}
+	}
+
+	if(tile.entries.empty())
+	{
+		return;
+	}
+
+	// ghosts are copied from any neighbor whose objects come near ours
+	vec2 reachMin = tile.extentMin - vec2(ghostWidth, ghostWidth);
+	vec2 reachMax = tile.extentMax + vec2(ghostWidth, ghostWidth);
+	for(const Tile& other : mTiles)
+	{
+		if(&other == &tile ||
+			other.extentMin.x > reachMax.x || other.extentMax.x < reachMin.x ||
+			other.extentMin.y > reachMax.y || other.extentMax.y < reachMin.y)
+		{
+			continue;
+		}
+
+		for(PhysicalCircle* obj : other.owned)
+		{
+			const vec3& pos = obj->getPosition();
+			if(obj->isCollisionActive() &&
+				pos.x >= reachMin.x && pos.x <= reachMax.x &&
+				pos.y >= reachMin.y && pos.y <= reachMax.y)
+			{
+				tile.entries.push_back(Entry{ pos, obj->getRadius(), obj, obj->getHandle().index, false });
+			}
+		}
+	}
+
+	// sort and sweep along x -- only entries closer than the widest possible contact are tested
+	std::sort(tile.entries.begin(), tile.entries.end(), [](const Entry& a, const Entry& b)
+	{
+		return a.position.x < b.position.x || (a.position.x == b.position.x && a.key < b.key);
+	});
+
+	for(size_t i = 0; i < tile.entries.size(); ++i)
+	{
+		const Entry& a = tile.entries[i];
+		float limit = a.position.x + a.radius + maxRadius + CONTACT_SLACK;
+
+		for(size_t j = i + 1; j < tile.entries.size() && tile.entries[j].position.x < limit; ++j)
+		{
+			const Entry& b = tile.entries[j];
+
+			// whoever owns the lower key keeps the pair, so neighbors never both report it
+			const Entry& first = a.key < b.key ? a : b;
+			const Entry& second = a.key < b.key ? b : a;
+			if(first.isOwned)
+			{
+				SpatialGrid::testContact(*first.object, first.position, *second.object, second.position,
+					first.radius + second.radius, tile.contacts);
+			}
+		}
+	}
+}
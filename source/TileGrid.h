@@ -0,0 +1,191 @@
+#pragma once
+
+#include "SpatialGrid.h"
+#include "Species.h"
+#include "ThreadPool.h"
+
+namespace Ecosim
+{
+	/**	Splits the world into one rectangular tile per
+	 *	worker thread, so a tick can run tile by tile in
+	 *	parallel with each worker mostly in its own cache.
+	 *
+	 *	Each tile owns the objects with active collision
+	 *	whose centers lie in it. Ownership is kept on the
+	 *	objects themselves, so removal never searches.
+	 *	Objects only change tiles when migrate runs, at
+	 *	the tick boundary; within a tick they may stray a
+	 *	little past their tile's edges.
+	 *
+	 *	Contacts are found per tile. A tile packs copies of
+	 *	its own objects' positions together with ghost
+	 *	copies of any neighbor's objects close enough to
+	 *	touch them, then sweeps along x. A pair is kept only
+	 *	by the tile that owns its object with the lower
+	 *	handle index, so each pair is found once however
+	 *	the tiles fall.
+	 */
+	class TileGrid final
+	{
+	public:
+
+		/**	Copy of one object's position and size,
+		 *	packed with the rest of its tile's.
+		 */
+		struct Entry
+		{
+			glm::vec3 position;
+			float radius;
+			PhysicalCircle* object;
+
+			// handle index, which orders pairs the same way in every tile
+			std::uint32_t key;
+			bool isOwned;
+		};
+
+		//=============================================================
+
+		/**	One rectangle of the world and the objects
+		 *	it owns.
+		 */
+		struct Tile
+		{
+			glm::vec2 min;
+			glm::vec2 max;
+
+			std::vector<PhysicalCircle*> owned;
+
+			// owned Agents by species, for per-tile work to fill as it needs
+			std::vector<Agent*> agents[Species::COUNT];
+
+			// box around the owned centers as they stand, and their largest radius
+			glm::vec2 extentMin;
+			glm::vec2 extentMax;
+			float maxRadius;
+
+			std::vector<Entry> entries;
+			std::vector<Contact> contacts;
+		};
+
+		typedef std::function<void(Tile&)> TileTask;
+
+		TileGrid(const TileGrid& other) = delete;
+		TileGrid& operator=(const TileGrid& other) = delete;
+		TileGrid(TileGrid&& other) = delete;
+		TileGrid& operator=(TileGrid&& other) = delete;
+
+		/**	@brief Constructor. Starts with no tiles, which
+		 *		   leaves the tick serial.
+		 */
+		TileGrid();
+
+		/**	@brief Destructor. Stops the workers.
+		 */
+		~TileGrid();
+
+		/**	@brief Sets the number of tiles, starting a
+		 *		   worker for each. Releases every object.
+		 *
+		 *	@param numTiles The number of tiles. 0 turns
+		 *					tiling off.
+		 */
+		void init(std::uint32_t numTiles);
+
+		/**	@brief Lays the tiles out over the world, as
+		 *		   close to square as the count allows.
+		 *		   Releases every object.
+		 *
+		 *	@param bounds The size of the world.
+		 */
+		void setBounds(const glm::vec2& bounds);
+
+		/**	@brief Hands objects that crossed a tile edge
+		 *		   to their new tile, takes in newly active
+		 *		   objects, and releases inactive ones.
+		 *
+		 *	@param objects The lists of every object.
+		 */
+		void migrate(const CollisionRegistry::Lists& objects);
+
+		/**	@brief Releases an object from its tile. Does
+		 *		   nothing if no tile owns it.
+		 *
+		 *	@param obj The object.
+		 */
+		void remove(PhysicalCircle& obj);
+
+		/**	@brief Runs a task on every tile, one tile per
+		 *		   worker, with the calling thread's World
+		 *		   bound. Returns once every tile is done.
+		 *
+		 *	@param task The task. Must touch only what its
+		 *				tile owns, or what nothing writes.
+		 */
+		void forEachTile(const TileTask& task);
+
+		/**	@brief Finds every pair of owned objects whose
+		 *		   circles overlap, as they stand now.
+		 *
+		 *	@param results Cleared, then filled with one
+		 *				   contact per pair, in the order
+		 *				   SpatialGrid::sortContacts gives.
+		 */
+		void findContacts(std::vector<Contact>& results);
+
+		/**	@brief Gets the number of tiles.
+		 *
+		 *	@return Returns the length of mTiles. 0 when
+		 *			tiling is off.
+		 */
+		std::uint32_t getNumTiles() const;
+
+		/**	@brief Gets one tile.
+		 *
+		 *	@param index The tile's index.
+		 *
+		 *	@return Returns the tile.
+		 */
+		const Tile& getTile(std::uint32_t index) const;
+
+	private:
+
+		/**	@brief Gets the tile whose rectangle holds a
+		 *		   point, clamped to the grid.
+		 *
+		 *	@param pos The point.
+		 *
+		 *	@return Returns the tile's index.
+		 */
+		std::uint32_t tileIndex(const glm::vec3& pos) const;
+
+		/**	@brief Gives an object to a tile.
+		 *
+		 *	@param obj The object. Must not be owned.
+		 *	@param index The tile's index.
+		 */
+		void add(PhysicalCircle& obj, std::uint32_t index);
+
+		/**	@brief Releases every object.
+		 */
+		void clear();
+
+		/**	@brief Packs a tile's objects and its ghosts,
+		 *		   then sweeps them for the contacts the
+		 *		   tile keeps.
+		 *
+		 *	@param tile The tile.
+		 *	@param ghostWidth How far past the tile's extent
+		 *					  ghosts are taken from.
+		 *	@param maxRadius The largest radius of any object.
+		 */
+		void sweepTile(Tile& tile, float ghostWidth, float maxRadius) const;
+
+
+		std::vector<Tile> mTiles;
+		std::unique_ptr<ThreadPool> mWorkers;
+
+		glm::vec2 mTileSize;
+		std::uint32_t mNumColumns;
+		std::uint32_t mNumRows;
+	};
+}
@@ -0,0 +1,266 @@
+#include "pch.h"
+#include "TimerWheel.h"
+
+#include "World.h"
+
+using namespace Ecosim;
+using namespace std;
+
+// length of one wheel tick, in simulation seconds
+const double TIMER_RESOLUTION = 1.0 / 32.0;
+
+TimerWheel::TimerWheel() :
+	mNextTick(0),
+	mNumPending(0),
+	mTime(0.0)
+{
+	for(uint32_t& bucket : mBuckets)
+	{
+		bucket = NIL;
+	}
+}
+
+//-------------------------------------------------------------
+
+void TimerWheel::advance(float deltaSeconds)
+{
+	mTime += deltaSeconds;
+
+	// run every tick that has fully elapsed
+	uint64_t currentTick = static_cast<uint64_t>(mTime / TIMER_RESOLUTION);
+	while(mNextTick <= currentTick)
+	{
+		processTick();
+	}
+}
+
+//-------------------------------------------------------------
+
+void TimerWheel::clear()
+{
+	mNodes.clear();
+	mFreeNodes.clear();
+	for(uint32_t& bucket : mBuckets)
+	{
+		bucket = NIL;
+	}
+
+	mNextTick = 0;
+	mNumPending = 0;
+	mTime = 0.0;
+}
+
+//-------------------------------------------------------------
+
+uint32_t TimerWheel::numPending() const
+{
+	return mNumPending;
+}
+
+//-------------------------------------------------------------
+
+TimerHandle TimerWheel::schedule(float delaySeconds, Callback callback)
+{
+	assert(callback);
+	TimerWheel& wheel = World::current().getTimerWheel();
+
+	// reuse a free node if there is one
+	uint32_t index;
+	if(!wheel.mFreeNodes.empty())
+	{
+		index = wheel.mFreeNodes.back();
+		wheel.mFreeNodes.pop_back();
+	}
+	else
+	{
+		index = static_cast<uint32_t>(wheel.mNodes.size());
+		wheel.mNodes.push_back(TimerNode{ nullptr, 0, 0, NIL, NIL, NIL });
+	}
+
+	// round up so a timer never fires before its delay has passed
+	TimerNode& node = wheel.mNodes[index];
+	node.callback = std::move(callback);
+	node.expiry = static_cast<uint64_t>(ceil((wheel.mTime + std::max(delaySeconds, 0.0f)) / TIMER_RESOLUTION));
+
+	wheel.insert(index);
+	++wheel.mNumPending;
+
+	return TimerHandle{ index, node.generation };
+}
+
+//-------------------------------------------------------------
+
+void TimerWheel::cancel(TimerHandle& handle)
+{
+	if(isPending(handle))
+	{
+		World::current().getTimerWheel().release(handle.index);
+	}
+	handle = TimerHandle();
+}
+
+//-------------------------------------------------------------
+
+bool TimerWheel::isPending(const TimerHandle& handle)
+{
+	const vector<TimerNode>& nodes = World::current().getTimerWheel().mNodes;
+
+	return handle.index < nodes.size() &&
+		nodes[handle.index].generation == handle.generation &&
+		nodes[handle.index].bucket != NIL;
+}
+
+//-------------------------------------------------------------
+
+double TimerWheel::getTime()
+{
+	return World::current().getTimerWheel().mTime;
+}
+
+//-------------------------------------------------------------
+
+void TimerWheel::processTick()
+{
+	uint64_t tick = mNextTick;
+
+	// at the start of each lap, pull the next coarse slot down a level
+	//		a slot index of 0 means the level above also finished a lap
+	if((tick & SLOT_MASK) == 0)
+	{
+		for(uint32_t level = 1; level < NUM_LEVELS; ++level)
+		{
+			uint32_t slot = static_cast<uint32_t>(tick >> (level * SLOT_BITS)) & SLOT_MASK;
+			cascade(level, slot);
+
+			if(slot != 0)
+			{
+				break;
+			}
+		}
+	}
+
+	// timers scheduled from callbacks are placed relative to the next tick
+	++mNextTick;
+
+	// move due timers aside first -- a callback may schedule into the slot we are draining
+	uint32_t slot = static_cast<uint32_t>(tick) & SLOT_MASK;
+	while(mBuckets[slot] != NIL)
+	{
+		uint32_t index = mBuckets[slot];
+		unlink(index);
+		link(index, RUNNING_BUCKET);
+	}
+
+	while(mBuckets[RUNNING_BUCKET] != NIL)
+	{
+		uint32_t index = mBuckets[RUNNING_BUCKET];
+
+		// a timer further out than the wheel spans was parked early -- put it back
+		if(mNodes[index].expiry > tick)
+		{
+			unlink(index);
+			insert(index);
+			continue;
+		}
+
+		Callback callback = std::move(mNodes[index].callback);
+		release(index);
+		callback();
+	}
+}
+
+//-------------------------------------------------------------
+
+void TimerWheel::cascade(uint32_t level, uint32_t slot)
+{
+	uint32_t bucket = level * NUM_SLOTS + slot;
+	while(mBuckets[bucket] != NIL)
+	{
+		uint32_t index = mBuckets[bucket];
+		unlink(index);
+		insert(index);
+	}
+}
+
+//-------------------------------------------------------------
+
+void TimerWheel::insert(uint32_t index)
+{
+	TimerNode& node = mNodes[index];
+
+	// already due -- run on the next tick
+	uint64_t expiry = std::max(node.expiry, mNextTick);
+
+	// clamp to the span of the wheel -- processTick re-inserts it if it comes up early
+	uint64_t delta = std::min<uint64_t>(expiry - mNextTick, (1ULL << (NUM_LEVELS * SLOT_BITS)) - 1);
+	expiry = mNextTick + delta;
+
+	// pick the finest level that can hold the delay
+	uint32_t level = 0;
+	while(delta >= (1ULL << ((level + 1) * SLOT_BITS)))
+	{
+		++level;
+	}
+
+	uint32_t slot = static_cast<uint32_t>(expiry >> (level * SLOT_BITS)) & SLOT_MASK;
+	link(index, level * NUM_SLOTS + slot);
+}
+
+//-------------------------------------------------------------
+
+void TimerWheel::link(uint32_t index, uint32_t bucket)
+{
+	TimerNode& node = mNodes[index];
+	uint32_t& head = mBuckets[bucket];
+
+	node.bucket = bucket;
+	node.prev = NIL;
+	node.next = head;
+
+	if(head != NIL)
+	{
+		mNodes[head].prev = index;
+	}
+	head = index;
+}
+
+//-------------------------------------------------------------
+
+void TimerWheel::unlink(uint32_t index)
+{
+	TimerNode& node = mNodes[index];
+	assert(node.bucket != NIL);
+
+	if(node.prev != NIL)
+	{
+		mNodes[node.prev].next = node.next;
+	}
+	else
+	{
+		mBuckets[node.bucket] = node.next;
+	}
+
+	if(node.next != NIL)
+	{
+		mNodes[node.next].prev = node.prev;
+	}
+
+	node.bucket = NIL;
+	node.prev = NIL;
+	node.next = NIL;
+}
+
+//-------------------------------------------------------------
+
+void TimerWheel::release(uint32_t index)
+{
+	unlink(index);
+
+	// bumping the generation makes outstanding handles stale
+	TimerNode& node = mNodes[index];
+	node.callback = nullptr;
+	++node.generation;
+
+	mFreeNodes.push_back(index);
+	--mNumPending;
+}
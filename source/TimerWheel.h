@@ -0,0 +1,171 @@
+#pragma once
+
+namespace Ecosim
+{
+	/**	Identifies a timer scheduled on the TimerWheel.
+	 *	Handles go stale once their timer fires or is
+	 *	cancelled, so they are safe to hold onto.
+	 */
+	struct TimerHandle
+	{
+		std::uint32_t index = UINT32_MAX;
+		std::uint32_t generation = 0;
+	};
+
+	//=============================================================
+
+	/**	Hierarchical timing wheel keyed to simulation
+	 *	time. Each World owns one, and the static
+	 *	functions act on the current World's wheel.
+	 *
+	 *	Timers are bucketed by expiry into a few levels of
+	 *	slots, each level coarser than the last. Advancing
+	 *	the wheel only touches the slot for each elapsed
+	 *	tick, plus an occasional cascade of a coarse slot
+	 *	into finer ones, so the cost of a frame follows the
+	 *	number of timers that fire rather than the number
+	 *	that are pending.
+	 */
+	class TimerWheel final
+	{
+	public:
+
+		typedef std::function<void()> Callback;
+
+		TimerWheel(const TimerWheel& other) = delete;
+		TimerWheel& operator=(const TimerWheel& other) = delete;
+		TimerWheel(TimerWheel&& other) = delete;
+		TimerWheel& operator=(TimerWheel&& other) = delete;
+
+		/** @brief Constructor.
+		 */
+		TimerWheel();
+
+		/**	@brief Destructor.
+		 */
+		~TimerWheel() = default;
+
+		/**	@brief Advances simulation time and fires every
+		 *		   timer that expires along the way.
+		 *
+		 *	@param deltaSeconds The scaled delta time for this frame.
+		 */
+		void advance(float deltaSeconds);
+
+		/**	@brief Cancels all pending timers and resets
+		 *		   simulation time to 0.
+		 */
+		void clear();
+
+		/**	@brief Gets the number of timers waiting to fire.
+		 *
+		 *	@return Returns mNumPending.
+		 */
+		std::uint32_t numPending() const;
+
+		/**	@brief Schedules a callback to run after a delay
+		 *		   in simulation time.
+		 *
+		 *	@param delaySeconds The simulation seconds to wait.
+		 *	@param callback The function to run.
+		 *
+		 *	@return Returns a handle that can cancel the timer.
+		 */
+		static TimerHandle schedule(float delaySeconds, Callback callback);
+
+		/**	@brief Cancels a pending timer. Does nothing if
+		 *		   the timer already fired or was cancelled.
+		 *
+		 *	@param handle The timer to cancel. Reset on return.
+		 */
+		static void cancel(TimerHandle& handle);
+
+		/**	@brief Says whether a timer is still waiting to fire.
+		 *
+		 *	@param handle The timer to check.
+		 *
+		 *	@return Returns true if the timer is pending.
+		 *			Otherwise, false.
+		 */
+		static bool isPending(const TimerHandle& handle);
+
+		/**	@brief Gets the simulation time the wheel has
+		 *		   advanced to.
+		 *
+		 *	@return Returns mTime, in seconds.
+		 */
+		static double getTime();
+
+	private:
+
+		/**	@brief Runs one tick of the wheel. Cascades coarse
+		 *		   slots that come due, then fires the timers in
+		 *		   the current fine slot.
+		 */
+		void processTick();
+
+		/**	@brief Re-buckets every timer in a coarse slot now
+		 *		   that its range is closer.
+		 *
+		 *	@param level The wheel level.
+		 *	@param slot The slot in that level.
+		 */
+		void cascade(std::uint32_t level, std::uint32_t slot);
+
+		/**	@brief Links a timer into the bucket that matches
+		 *		   its expiry.
+		 *
+		 *	@param index The timer's node index.
+		 */
+		void insert(std::uint32_t index);
+
+		/**	@brief Links a timer at the head of a bucket.
+		 *
+		 *	@param index The timer's node index.
+		 *	@param bucket The bucket to link into.
+		 */
+		void link(std::uint32_t index, std::uint32_t bucket);
+
+		/**	@brief Unlinks a timer from whichever bucket
+		 *		   it is in.
+		 *
+		 *	@param index The timer's node index.
+		 */
+		void unlink(std::uint32_t index);
+
+		/**	@brief Unlinks a timer and returns its node to
+		 *		   the free list.
+		 *
+		 *	@param index The timer's node index.
+		 */
+		void release(std::uint32_t index);
+
+
+		static const std::uint32_t NUM_LEVELS = 4;
+		static const std::uint32_t SLOT_BITS = 6;
+		static const std::uint32_t NUM_SLOTS = 1 << SLOT_BITS;
+		static const std::uint32_t SLOT_MASK = NUM_SLOTS - 1;
+		static const std::uint32_t NUM_BUCKETS = NUM_LEVELS * NUM_SLOTS + 1;
+		static const std::uint32_t RUNNING_BUCKET = NUM_LEVELS * NUM_SLOTS;
+		static const std::uint32_t NIL = UINT32_MAX;
+
+		struct TimerNode
+		{
+			Callback callback;
+			std::uint64_t expiry;
+			std::uint32_t generation;
+			std::uint32_t bucket;
+			std::uint32_t prev;
+			std::uint32_t next;
+		};
+
+		std::vector<TimerNode> mNodes;
+		std::vector<std::uint32_t> mFreeNodes;
+		std::uint32_t mBuckets[NUM_BUCKETS];
+
+		std::uint64_t mNextTick;
+		std::uint32_t mNumPending;
+
+		double mTime;
+	};
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+namespace Ecosim
+{
+	/**	Lock-free handoff of the latest value from one
+	 *	producer thread to one consumer thread.
+	 *
+	 *	The producer always owns one buffer to write and
+	 *	the consumer always owns one buffer to read. The
+	 *	third sits between them. Publishing swaps the
+	 *	written buffer into the middle; acquiring swaps
+	 *	the middle buffer out if it is newer than what
+	 *	the consumer holds. Neither side ever waits, and
+	 *	the consumer simply skips stale values when the
+	 *	producer runs faster.
+	 */
+	template <typename T>
+	class TripleBuffer final
+	{
+	public:
+
+		TripleBuffer(const TripleBuffer& other) = delete;
+		TripleBuffer& operator=(const TripleBuffer& other) = delete;
+		TripleBuffer(TripleBuffer&& other) = delete;
+		TripleBuffer& operator=(TripleBuffer&& other) = delete;
+
+		/**	@brief Constructor.
+		 */
+		TripleBuffer();
+
+		/**	@brief Destructor.
+		 */
+		~TripleBuffer() = default;
+
+		/**	@brief Gets the buffer the producer is filling.
+		 *		   Only the producer thread may call this.
+		 *
+		 *	@return Returns the write buffer.
+		 */
+		T& getWriteBuffer();
+
+		/**	@brief Hands the write buffer to the consumer and
+		 *		   takes a new one to write into. Only the
+		 *		   producer thread may call this.
+		 */
+		void publish();
+
+		/**	@brief Takes the most recently published buffer,
+		 *		   if there is one the consumer hasn't seen.
+		 *		   Only the consumer thread may call this.
+		 *
+		 *	@return Returns true if the read buffer changed.
+		 *			Otherwise, false.
+		 */
+		bool acquire();
+
+		/**	@brief Gets the buffer the consumer last acquired.
+		 *		   Only the consumer thread may call this.
+		 *
+		 *	@return Returns the read buffer.
+		 */
+		const T& getReadBuffer() const;
+
+	private:
+
+		// the middle slot carries a flag saying it holds an unread publish
+		static const std::uint32_t INDEX_MASK = 0x3;
+		static const std::uint32_t FRESH_BIT = 0x4;
+
+		T mBuffers[3];
+
+		std::uint32_t mWriteIndex;
+		std::uint32_t mReadIndex;
+		std::atomic<std::uint32_t> mMiddle;
+	};
+
+#include "TripleBuffer.inl"
+}
@@ -0,0 +1,48 @@
+
+template <typename T>
+TripleBuffer<T>::TripleBuffer() :
+	mWriteIndex(0),
+	mReadIndex(1),
+	mMiddle(2)
+{
+}
+
+//-------------------------------------------------------------
+
+template <typename T>
+T& TripleBuffer<T>::getWriteBuffer()
+{
+	return mBuffers[mWriteIndex];
+}
+
+//-------------------------------------------------------------
+
+template <typename T>
+void TripleBuffer<T>::publish()
+{
+	// release our writes along with the buffer, take back whatever was in the middle
+	mWriteIndex = mMiddle.exchange(mWriteIndex | FRESH_BIT, std::memory_order_acq_rel) & INDEX_MASK;
+}
+
+//-------------------------------------------------------------
+
+template <typename T>
+bool TripleBuffer<T>::acquire()
+{
+	if((mMiddle.load(std::memory_order_relaxed) & FRESH_BIT) == 0)
+	{
+		return false;
+	}
+
+	// only the consumer clears the flag, so the middle is still fresh here
+	mReadIndex = mMiddle.exchange(mReadIndex, std::memory_order_acq_rel) & INDEX_MASK;
+	return true;
+}
+
+//-------------------------------------------------------------
+
+template <typename T>
+const T& TripleBuffer<T>::getReadBuffer() const
+{
+	return mBuffers[mReadIndex];
+}
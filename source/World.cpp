@@ -0,0 +1,389 @@
+#include "pch.h"
+#include "World.h"
+
+#include "Environment.h"
+#include "AgentManager.h"
+#include "Species.h"
+
+using namespace std::chrono;
+using namespace Ecosim;
+using namespace std;
+using namespace glm;
+
+// width of a spatial index cell -- a few agent diameters
+const float SPATIAL_CELL_SIZE = 64.0f;
+const float FAR_FIELD_CELL_SIZE = 64.0f;
+
+thread_local World* World::sCurrent = nullptr;
+
+const char* PhaseTimes::getName(Phase phase)
+{
+	static const char* sNames[COUNT] = { "components", "timers", "events", "spatial_index", "state_hash" };
+
+	assert(phase < COUNT);
+	return sNames[phase];
+}
+
+//=============================================================
+
+World::Scope::Scope(World& world) :
+	mPrevious(sCurrent),
+	mRandomScope(world.mRng)
+{
+	sCurrent = &world;
+}
+
+//-------------------------------------------------------------
+
+World::Scope::~Scope()
+{
+	sCurrent = mPrevious;
+}
+
+//=============================================================
+
+World& World::current()
+{
+	assert(sCurrent != nullptr);
+	return *sCurrent;
+}
+
+//-------------------------------------------------------------
+
+World::World() :
+	mSpatialIndex(SPATIAL_CELL_SIZE),
+	mBounds(0.0f, 0.0f),
+	mMaxDistance(0.0f),
+	mStateHash(0)
+{
+}
+
+//-------------------------------------------------------------
+
+World::~World()
+{
+	// components unsubscribe and unregister as they go, so they need us bound
+	Scope scope(*this);
+
+	mComponents.clear();
+	mEnvironment.reset();
+	mAgentManager.reset();
+}
+
+//-------------------------------------------------------------
+
+void World::init(const WorldConfig& config)
+{
+	Scope scope(*this);
+
+	mConfig = config;
+	mRng.seed(mConfig.seed);
+	mStateHash = 0;
+	mPhaseTimes = PhaseTimes();
+
+	// approximate perception summarizes every type some species sees
+	mFarFields.clear();
+	if(mConfig.params.perceptionTheta > 0.0f)
+	{
+		for(uint32_t i = 0; i < Species::COUNT; ++i)
+		{
+			const Species& species = Species::get(static_cast<Species::ID>(i));
+			for(uint32_t j = 0; j < species.numVisibleTypes; ++j)
+			{
+				uint64_t typeID = species.visibleTypes[j]();
+				if(findFarField(typeID) == nullptr)
+				{
+					mFarFields.emplace_back(new FarFieldGrid(typeID, FAR_FIELD_CELL_SIZE));
+				}
+			}
+		}
+	}
+
+	mTileGrid.init(mConfig.numTiles);
+	setBounds(mConfig.bounds);
+
+	// create components
+	mEnvironment = std::make_shared<Environment>();
+	mAgentManager = std::make_shared<AgentManager>();
+
+	// init components
+	mEnvironment->init();
+	mAgentManager->init();
+
+	// add components to lists
+	mComponents.push_back(mEnvironment);
+	mComponents.push_back(mAgentManager);
+
+	PhysicalCircle::updateSpatialIndex();
+}
+
+//-------------------------------------------------------------
+
+void World::shutdown()
+{
+	Scope scope(*this);
+
+	for(auto& component : mComponents)
+	{
+		component->shutdown();
+	}
+
+	mComponents.clear();
+	mEnvironment.reset();
+	mAgentManager.reset();
+
+	mTimerWheel.clear();
+	mEventQueue.clear();
+}
+
+//-------------------------------------------------------------
+
+void World::update(const SimClock& clock)
+{
+	Scope scope(*this);
+
+	// phases are only timed when asked for -- reading the clock isn't free
+	steady_clock::time_point phaseStart;
+	auto endPhase = [this, &phaseStart](PhaseTimes::Phase phase)
+	{
+		if(mConfig.profilesPhases)
+		{
+			steady_clock::time_point now = steady_clock::now();
+			mPhaseTimes.seconds[phase] += duration<double>(now - phaseStart).count();
+			phaseStart = now;
+		}
+	};
+
+	if(mConfig.profilesPhases)
+	{
+		phaseStart = steady_clock::now();
+	}
+
+	for(auto& component : mComponents)
+	{
+		component->update(clock);
+	}
+	endPhase(PhaseTimes::COMPONENTS);
+
+	// fire spawns, expiries, and lifetimes that came due this frame
+	mTimerWheel.advance(clock.getDeltaTimeScaled());
+	endPhase(PhaseTimes::TIMERS);
+
+	// deliver any events that were posted this frame
+	mEventQueue.update();
+	endPhase(PhaseTimes::EVENTS);
+
+	// objects are done moving -- rebucket them for queries
+	PhysicalCircle::updateSpatialIndex();
+	endPhase(PhaseTimes::SPATIAL_INDEX);
+
+	if(mConfig.hashesState)
+	{
+		// fold this tick's state into the running hash
+		collectEntityHashes(mEntityHashes);
+
+		StateHash hash(mStateHash);
+		hash.add(TimerWheel::getTime());
+		for(const EntityHash& entity : mEntityHashes)
+		{
+			hash.add(entity.hash);
+		}
+		mStateHash = hash.get();
+		endPhase(PhaseTimes::STATE_HASH);
+	}
+}
+
+//-------------------------------------------------------------
+
+void World::render(DrawList& drawList)
+{
+	Scope scope(*this);
+
+	for(auto& component : mComponents)
+	{
+		component->render(drawList);
+	}
+}
+
+//-------------------------------------------------------------
+
+uint64_t World::getStateHash() const
+{
+	return mStateHash;
+}
+
+//-------------------------------------------------------------
+
+const PhaseTimes& World::getPhaseTimes() const
+{
+	return mPhaseTimes;
+}
+
+//-------------------------------------------------------------
+
+void World::collectEntityHashes(EntityHashes& outHashes)
+{
+	Scope scope(*this);
+
+	outHashes.clear();
+	for(const auto& component : mComponents)
+	{
+		component->hashState(outHashes);
+	}
+}
+
+//-------------------------------------------------------------
+
+const WorldConfig& World::getConfig() const
+{
+	return mConfig;
+}
+
+//-------------------------------------------------------------
+
+AgentManager& World::getAgentManager()
+{
+	assert(mAgentManager != nullptr);
+	return *mAgentManager;
+}
+
+//-------------------------------------------------------------
+
+Environment& World::getEnvironment()
+{
+	assert(mEnvironment != nullptr);
+	return *mEnvironment;
+}
+
+//-------------------------------------------------------------
+
+EventQueue& World::getEventQueue()
+{
+	return mEventQueue;
+}
+
+//-------------------------------------------------------------
+
+TimerWheel& World::getTimerWheel()
+{
+	return mTimerWheel;
+}
+
+//-------------------------------------------------------------
+
+IPublisher::Subscribers& World::getSubscribers(uint64_t eventTypeID)
+{
+	return mSubscribers[eventTypeID];
+}
+
+//-------------------------------------------------------------
+
+CollisionRegistry& World::getCollisionRegistry()
+{
+	return mCollisionRegistry;
+}
+
+//-------------------------------------------------------------
+
+World::ObjectRegistry& World::getObjectRegistry()
+{
+	return mObjectRegistry;
+}
+
+//-------------------------------------------------------------
+
+SpatialGrid& World::getSpatialIndex()
+{
+	return mSpatialIndex;
+}
+
+//-------------------------------------------------------------
+
+void World::updateFarFields()
+{
+	for(auto& farField : mFarFields)
+	{
+		farField->build(mCollisionRegistry.getLists(farField->getTypeID()));
+	}
+}
+
+//-------------------------------------------------------------
+
+const FarFieldGrid* World::findFarField(uint64_t typeID) const
+{
+	for(const auto& farField : mFarFields)
+	{
+		if(farField->getTypeID() == typeID)
+		{
+			return farField.get();
+		}
+	}
+
+	return nullptr;
+}
+
+//-------------------------------------------------------------
+
+TileGrid& World::getTileGrid()
+{
+	return mTileGrid;
+}
+
+//-------------------------------------------------------------
+
+void World::setBounds(const vec2& bounds)
+{
+	mBounds = bounds;
+	mMaxDistance = glm::sqrt((mBounds.x * mBounds.x) + (mBounds.y * mBounds.y));
+
+	mSpatialIndex.setBounds(mBounds);
+	mTileGrid.setBounds(mBounds);
+	for(auto& farField : mFarFields)
+	{
+		farField->setBounds(mBounds);
+	}
+}
+
+//-------------------------------------------------------------
+
+const vec2& World::getBounds() const
+{
+	return mBounds;
+}
+
+//-------------------------------------------------------------
+
+float World::getMaxDistance() const
+{
+	return mMaxDistance;
+}
+
+//-------------------------------------------------------------
+
+GenomeCounters& World::getGenomeCounters()
+{
+	return mGenomeCounters;
+}
+
+//-------------------------------------------------------------
+
+Rng& World::getRng()
+{
+	return mRng;
+}
+
+//-------------------------------------------------------------
+
+void World::setResourceTraits(uint64_t typeID, const ResourceTraits& traits)
+{
+	mResourceTraits[typeID] = traits;
+}
+
+//-------------------------------------------------------------
+
+const ResourceTraits& World::getResourceTraits(uint64_t typeID) const
+{
+	auto iter = mResourceTraits.find(typeID);
+	assert(iter != mResourceTraits.end());
+	return iter->second;
+}
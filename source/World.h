@@ -0,0 +1,410 @@
+#pragma once
+
+#include "CollisionRegistry.h"
+#include "EventQueue.h"
+#include "FarFieldGrid.h"
+#include "TimerWheel.h"
+#include "SlotMap.h"
+#include "SpatialGrid.h"
+#include "TileGrid.h"
+
+#include "ISimComponent.h"
+#include "SimParams.h"
+
+namespace Ecosim
+{
+	class Environment;
+	class AgentManager;
+
+	/**	Starting population of one species. Its Agents
+	 *	are built in memory, either as mutated clones of
+	 *	a template Genome or from random Genomes.
+	 */
+	struct SpeciesConfig
+	{
+		bool isPrey = true;
+		std::uint32_t count = 0;
+
+		// serialized template, as Genome::writeToStream writes it -- empty makes random Genomes.
+		// a template's header overrides isPrey
+		std::string genome;
+
+		// random Genomes connect every sensor to every output
+		float weightRange = 1.0f;
+		float sizeGene = 15.0f;
+	};
+
+	//=============================================================
+
+	/**	Collection of data used to initialize
+	 *	a World.
+	 */
+	struct WorldConfig
+	{
+		glm::vec2 bounds = glm::vec2(0.0f, 0.0f);
+		SimParams params;
+		std::uint64_t seed = 0;
+
+		// empty makes one Agent per Genome file
+		std::vector<SpeciesConfig> species;
+		// Resources of each type spawned up front
+		std::uint32_t numResources = 0;
+
+		// 0 ticks serially -- otherwise the world is split into this many tiles, each with its own worker
+		std::uint32_t numTiles = 0;
+
+		bool savesGenomes = true;
+		bool logsFitness = true;
+		bool hashesState = false;
+		bool profilesPhases = false;
+	};
+
+	//=============================================================
+
+	/**	Wall time a World has spent in each part of
+	 *	its update, summed over every tick so far.
+	 */
+	struct PhaseTimes
+	{
+		enum Phase
+		{
+			COMPONENTS,
+			TIMERS,
+			EVENTS,
+			SPATIAL_INDEX,
+			STATE_HASH,
+			COUNT
+		};
+
+		double seconds[COUNT] = {};
+
+		/**	@brief Gets the display name of a phase.
+		 *
+		 *	@param phase The phase.
+		 *
+		 *	@return Returns the name, in lower case.
+		 */
+		static const char* getName(Phase phase);
+	};
+
+	//=============================================================
+
+	/**	Traits shared by every object of one Resource
+	 *	type within a World.
+	 */
+	struct ResourceTraits
+	{
+		glm::vec3 color;
+		float lifetime;
+		float size;
+		float yield;
+	};
+
+	//=============================================================
+
+	/**	Counters that keep Genome IDs and Gene innovation
+	 *	numbers unique within a World.
+	 */
+	struct GenomeCounters
+	{
+		std::uint32_t nextInnovation = 0;
+		std::uint32_t nextID = 0;
+		std::uint32_t highestInnovParsed = UINT32_MAX;
+		std::uint32_t highestIDParsed = 0;
+	};
+
+	//=============================================================
+
+	/**	One self-contained simulated ecosystem.
+	 *
+	 *	A World owns its components along with all of the
+	 *	state they share: the EventQueue and TimerWheel,
+	 *	Event subscriber lists, the PhysicalCircle
+	 *	registries and spatial index, Genome counters,
+	 *	Resource traits, and the random stream. Nothing in one World can see
+	 *	another, so several can run side by side on
+	 *	different threads. The GenomeCache is the one
+	 *	thing they share.
+	 *
+	 *	Code inside a World reaches its state through
+	 *	World::current(), which is bound per thread. Every
+	 *	World entry point binds itself for its duration;
+	 *	anything else that touches a World's objects from
+	 *	outside must hold a World::Scope.
+	 */
+	class World final
+	{
+	public:
+
+		/**	Binds a World, along with its random stream,
+		 *	to the calling thread for the lifetime of the
+		 *	Scope, then restores whatever was bound before.
+		 */
+		class Scope final
+		{
+		public:
+
+			Scope(const Scope& other) = delete;
+			Scope& operator=(const Scope& other) = delete;
+			Scope(Scope&& other) = delete;
+			Scope& operator=(Scope&& other) = delete;
+
+			/**	@brief Constructor. Binds a World.
+			 *
+			 *	@param world The World to bind.
+			 */
+			explicit Scope(World& world);
+
+			/**	@brief Destructor. Restores the previous World.
+			 */
+			~Scope();
+
+		private:
+
+			World* mPrevious;
+			Random::Scope mRandomScope;
+		};
+
+		typedef SlotMap<PhysicalCircle*> ObjectRegistry;
+
+		World(const World& other) = delete;
+		World& operator=(const World& other) = delete;
+		World(World&& other) = delete;
+		World& operator=(World&& other) = delete;
+
+		/**	@brief Constructor.
+		 */
+		World();
+
+		/**	@brief Destructor. Releases any components
+		 *		   left over from a missing shutdown.
+		 */
+		~World();
+
+		/**	@brief Sizes the world, then creates and
+		 *		   initializes its components.
+		 *
+		 *	@param config The config data. Copied.
+		 */
+		void init(const WorldConfig& config);
+
+		/**	@brief Shuts down and releases all components,
+		 *		   and cancels pending timers and events.
+		 */
+		void shutdown();
+
+		/**	@brief Updates components, fires timers that came
+		 *		   due, delivers events posted this frame, and
+		 *		   rebuckets objects for queries.
+		 *
+		 *	@param clock The simulation's timekeeper.
+		 */
+		void update(const SimClock& clock);
+
+		/**	@brief Has every component draw itself.
+		 *
+		 *	@param drawList The frame being drawn.
+		 */
+		void render(DrawList& drawList);
+
+		/**	@brief Gets the rolling hash of the World's state.
+		 *		   Only kept when the config asks for it.
+		 *
+		 *	@return Returns mStateHash, which folds in the
+		 *			state after every tick so far.
+		 */
+		std::uint64_t getStateHash() const;
+
+		/**	@brief Gets the time spent in each part of the
+		 *		   update. Only kept when the config asks
+		 *		   for it.
+		 *
+		 *	@return Returns mPhaseTimes.
+		 */
+		const PhaseTimes& getPhaseTimes() const;
+
+		/**	@brief Hashes the state of every object in the
+		 *		   World as it stands now.
+		 *
+		 *	@param outHashes Receives the hashes. Cleared first.
+		 */
+		void collectEntityHashes(EntityHashes& outHashes);
+
+		/**	@brief Gets the config data the World was
+		 *		   initialized with.
+		 *
+		 *	@return Returns mConfig.
+		 */
+		const WorldConfig& getConfig() const;
+
+		/**	@brief Gets the component managing the Agents.
+		 *
+		 *	@return Returns a reference to mAgentManager.
+		 */
+		AgentManager& getAgentManager();
+
+		/**	@brief Gets the component managing Resources
+		 *		   and scent.
+		 *
+		 *	@return Returns a reference to mEnvironment.
+		 */
+		Environment& getEnvironment();
+
+		/**	@brief Gets this World's event queue.
+		 *
+		 *	@return Returns mEventQueue.
+		 */
+		EventQueue& getEventQueue();
+
+		/**	@brief Gets this World's timer wheel.
+		 *
+		 *	@return Returns mTimerWheel.
+		 */
+		TimerWheel& getTimerWheel();
+
+		/**	@brief Gets the subscribers to one Event type.
+		 *
+		 *	@param eventTypeID The type ID of the Event<T>.
+		 *
+		 *	@return Returns the subscriber list, created
+		 *			empty if the type has none yet.
+		 */
+		IPublisher::Subscribers& getSubscribers(std::uint64_t eventTypeID);
+
+		/**	@brief Gets the registered PhysicalCircles,
+		 *		   listed by type.
+		 *
+		 *	@return Returns mCollisionRegistry.
+		 */
+		CollisionRegistry& getCollisionRegistry();
+
+		/**	@brief Gets the registry that hands out a
+		 *		   handle to every PhysicalCircle.
+		 *
+		 *	@return Returns mObjectRegistry.
+		 */
+		ObjectRegistry& getObjectRegistry();
+
+		/**	@brief Gets the spatial index of PhysicalCircles
+		 *		   with active collision.
+		 *
+		 *	@return Returns mSpatialIndex.
+		 */
+		SpatialGrid& getSpatialIndex();
+
+		/**	@brief Rebuilds the far-field summary of every
+		 *		   type some Species sees. Only kept when
+		 *		   the config's perception theta is above 0.
+		 */
+		void updateFarFields();
+
+		/**	@brief Finds the far-field summary of a type.
+		 *
+		 *	@param typeID The type ID of the objects.
+		 *
+		 *	@return Returns the summary, or nullptr if
+		 *			perception is exact.
+		 */
+		const FarFieldGrid* findFarField(std::uint64_t typeID) const;
+
+		/**	@brief Gets the tiles the tick is split into.
+		 *		   Has none unless the config asks for them.
+		 *
+		 *	@return Returns mTileGrid.
+		 */
+		TileGrid& getTileGrid();
+
+		/**	@brief Sets the size of the world and the maximum
+		 *		   distance between two points in it. Resizes
+		 *		   the spatial index, far fields, and tiles
+		 *		   to match.
+		 *
+		 *	@param bounds The new bounds.
+		 */
+		void setBounds(const glm::vec2& bounds);
+
+		/**	@brief Gets the size of the world.
+		 *
+		 *	@return Returns mBounds.
+		 */
+		const glm::vec2& getBounds() const;
+
+		/**	@brief Gets the maximum distance between two
+		 *		   points in the world.
+		 *
+		 *	@return Returns mMaxDistance.
+		 */
+		float getMaxDistance() const;
+
+		/**	@brief Gets the Genome ID and Gene innovation
+		 *		   counters.
+		 *
+		 *	@return Returns mGenomeCounters.
+		 */
+		GenomeCounters& getGenomeCounters();
+
+		/**	@brief Sets the traits of one Resource type.
+		 *
+		 *	@param typeID The type ID of the Resource<T>.
+		 *	@param traits The new traits.
+		 */
+		void setResourceTraits(std::uint64_t typeID, const ResourceTraits& traits);
+
+		/**	@brief Gets the traits of one Resource type.
+		 *		   The type must have been set up first.
+		 *
+		 *	@param typeID The type ID of the Resource<T>.
+		 *
+		 *	@return Returns the traits. The reference stays
+		 *			valid for the life of the World.
+		 */
+		const ResourceTraits& getResourceTraits(std::uint64_t typeID) const;
+
+		/**	@brief Gets the World's random stream. Agents
+		 *		   split their own streams from it.
+		 *
+		 *	@return Returns mRng.
+		 */
+		Rng& getRng();
+
+		/**	@brief Gets the World bound to the calling thread.
+		 *
+		 *	@return Returns a reference to the bound World.
+		 */
+		static World& current();
+
+	private:
+
+		WorldConfig mConfig;
+
+		std::vector<std::shared_ptr<ISimComponent>> mComponents;
+		std::shared_ptr<Environment> mEnvironment;
+		std::shared_ptr<AgentManager> mAgentManager;
+
+		EventQueue mEventQueue;
+		TimerWheel mTimerWheel;
+
+		std::unordered_map<std::uint64_t, IPublisher::Subscribers> mSubscribers;
+
+		CollisionRegistry mCollisionRegistry;
+		ObjectRegistry mObjectRegistry;
+		SpatialGrid mSpatialIndex;
+		std::vector<std::unique_ptr<FarFieldGrid>> mFarFields;
+		TileGrid mTileGrid;
+
+		glm::vec2 mBounds;
+		float mMaxDistance;
+
+		GenomeCounters mGenomeCounters;
+		std::unordered_map<std::uint64_t, ResourceTraits> mResourceTraits;
+
+		Rng mRng;
+
+		std::uint64_t mStateHash;
+		EntityHashes mEntityHashes;
+
+		PhaseTimes mPhaseTimes;
+
+		static thread_local World* sCurrent;
+	};
+}
@@ -1,6 +1,10 @@
 
 #include "pch.h"
 #include "Simulation.h"
+#include "DeterminismCheck.h"
+#include "IslandCoordinator.h"
+#include "Scenario.h"
+#include "SweepRunner.h"
 
 using namespace Ecosim;
 using namespace std;
@@ -10,30 +14,88 @@ string sName = "EcoSim";
 int32_t sWidth = 1500;
 int32_t sHeight = 1000;
 
+float sWorldWidth = 1500.0f;
+float sWorldHeight = 1000.0f;
+
 int32_t main(int32_t argc, char* argv[])
 {
-	UNREFERENCED_PARAMETER(argc);
-	UNREFERENCED_PARAMETER(argv);
-
 	// init random
 	Random::seedRandom();
 
+	// headless determinism check: --verify <ticks> [first seed] [second seed] [second tiles]
+	if(argc > 2 && string(argv[1]) == "--verify")
+	{
+		WorldConfig first;
+		first.bounds = vec2(sWorldWidth, sWorldHeight);
+		first.seed = argc > 3 ? strtoull(argv[3], nullptr, 10) : 0;
+
+		// a tiled second World checks the tiled tick against the serial one
+		WorldConfig second = first;
+		second.seed = argc > 4 ? strtoull(argv[4], nullptr, 10) : first.seed;
+		second.numTiles = argc > 5 ? static_cast<uint32_t>(std::max(atoi(argv[5]), 0)) : 0;
+
+		DeterminismCheck check;
+		check.init(first, second);
+		return check.run(strtoull(argv[2], nullptr, 10), 1.0f / 60.0f);
+	}
+
+	// headless parameter sweep: --sweep <sweep file>
+	if(argc > 2 && string(argv[1]) == "--sweep")
+	{
+		SweepRunner sweepRunner;
+		if(!sweepRunner.init(argv[2], vec2(sWorldWidth, sWorldHeight)))
+		{
+			return -1;
+		}
+
+		return sweepRunner.run();
+	}
+
+	// headless island run: --islands [count] [ring|full]
+	if(argc > 1 && string(argv[1]) == "--islands")
+	{
+		IslandConfig islandConfig;
+		islandConfig.worldSize = vec2(sWorldWidth, sWorldHeight);
+		islandConfig.seed = Random::randomSeed();
+
+		if(argc > 2)
+		{
+			islandConfig.numIslands = static_cast<uint32_t>(std::max(atoi(argv[2]), 1));
+		}
+		if(argc > 3 && string(argv[3]) == "full")
+		{
+			islandConfig.topology = MigrationTopology::FULLY_CONNECTED;
+		}
+
+		IslandCoordinator coordinator;
+		coordinator.init(islandConfig);
+		return coordinator.run();
+	}
+
 	// set renderer configuration
 	RenderConfig renderConfig;
 	renderConfig.name = sName;
 	renderConfig.width = sWidth;
 	renderConfig.height = sHeight;
 
-	Renderer* renderer = Renderer::instance();
-	renderer->setConfig(renderConfig);
+	Renderer renderer;
+	renderer.setConfig(renderConfig);
 
 	// set simulation configuration
 	SimConfig simConfig;
-	simConfig.eventQueue = EventQueue::instance();
-	simConfig.renderer = renderer;
+	simConfig.renderer = &renderer;
+	simConfig.world.bounds = vec2(sWorldWidth, sWorldHeight);
+	simConfig.world.seed = Random::randomSeed();
+	simConfig.usesRenderThread = true;
+
+	// windowed run of a scenario file: --scenario <file>
+	if(argc > 2 && string(argv[1]) == "--scenario" && !Scenario::readFromFile(argv[2], simConfig.world))
+	{
+		return -1;
+	}
 
-	Simulation* simulation = Simulation::instance();
-	simulation->setConfig(simConfig);
+	Simulation simulation;
+	simulation.setConfig(simConfig);
 
-	return simulation->run();
+	return simulation.run();
 }
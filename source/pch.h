@@ -1,16 +1,24 @@
 
 #pragma once
+#ifdef _MSC_VER
 #pragma warning(disable:4201)
 #pragma warning(disable:4505)
+#endif
 
 // standard includes
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <condition_variable>
 #include <cstdint>
 #include <cstdlib>
-#include <filesystem>
+#include <deque>
 #include <fstream>
 #include <functional>
 #include <iostream>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <queue>
 #include <string>
 #include <sstream>
@@ -18,6 +26,13 @@
 #include <unordered_map>
 #include <vector>
 
+// std::experimental::filesystem lives in <filesystem> on MSVC only
+#ifdef _MSC_VER
+#include <filesystem>
+#else
+#include <experimental/filesystem>
+#endif
+
 // external dependencies
 #include "glm.hpp"
 
@@ -27,7 +42,18 @@
 
 // macros
 #ifndef UNREFERENCED_PARAMETER
-#define UNREFERENCED_PARAMETER(x)x
+#define UNREFERENCED_PARAMETER(x)(void)(x)
+#endif
+
+// MSVC marks interfaces abstract -- other compilers just drop the keyword
+#ifndef _MSC_VER
+#define abstract
+#endif
+
+#ifdef _WIN32
+#define DIR_SEPARATOR "\\"
+#else
+#define DIR_SEPARATOR "/"
 #endif
 
 #define DRAWS_VISION_CONES	0
@@ -39,8 +65,6 @@
 #define PI		3.14159265359f
 #define TWOPI	6.28318530718f
 
-#define PERCEPTION_NUM_VISION_CONES	8
-
 #define NETWORK_MAX_NODES	10000
 #define NETWORK_MAX_IN		27
 #define NETWORK_MIN_IN		11
@@ -49,28 +73,20 @@
 #define NETWORK_NUM_HIDDEN		15
 #define NETWORK_NUM_OUT			3
 
-#define PREDATOR_COLOR			glm::vec3(1.0f, 0.5f, 0.5f)
 #define PREDATOR_FITNESS_FILE	"pred_fitness.csv"
-#define PREDATOR_NUM_INPUTS		19
-
-#define PREY_COLOR			glm::vec3(1.0f, 1.0f, 0.5f)
 #define PREY_FITNESS_FILE	"prey_fitness.csv"
-#define PREY_NUM_INPUTS		27
-
-#define AGENT_COLOR			glm::vec3(0.85f, 0.85f, 0.85f)
 #define AGENT_FITNESS_FILE	"fitness.csv"
-#define AGENT_NUM_INPUTS	27
 
 #if USES_NEAT
 #if USES_PREDATOR_PREY
-#define DIR_GENOMES	"assets\\config_neat\\genomes_predprey\\"
+#define DIR_GENOMES	"assets" DIR_SEPARATOR "config_neat" DIR_SEPARATOR "genomes_predprey" DIR_SEPARATOR
 #else
-#define DIR_GENOMES	"assets\\config_neat\\genomes_agents\\"
+#define DIR_GENOMES	"assets" DIR_SEPARATOR "config_neat" DIR_SEPARATOR "genomes_agents" DIR_SEPARATOR
 #endif
 #else
 #if USES_PREDATOR_PREY
-#define DIR_GENOMES	"assets\\config_static\\genomes_predprey\\"
+#define DIR_GENOMES	"assets" DIR_SEPARATOR "config_static" DIR_SEPARATOR "genomes_predprey" DIR_SEPARATOR
 #else
-#define DIR_GENOMES	"assets\\config_static\\genomes_agents\\"
+#define DIR_GENOMES	"assets" DIR_SEPARATOR "config_static" DIR_SEPARATOR "genomes_agents" DIR_SEPARATOR
 #endif
 #endif